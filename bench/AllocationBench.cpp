@@ -0,0 +1,228 @@
+/**
+ * @file AllocationBench.cpp
+ * @brief Steady-state heap allocations on the transport paths
+ *
+ * Replaces the global operator new/delete of the bench binary with
+ * counting versions, then runs the hot paths with their memory resource
+ * pointed at a pool over a preallocated arena. Counters:
+ *
+ * - heap_allocs_per_frame: global operator new calls per frame during
+ *   the timed loop (expected 0 for the arena-backed variants)
+ * - arena_allocs: pool refills from the arena during the timed loop
+ *   (0 once queues and pools are warm)
+ *
+ * BM_VectorQueueAllocations is the std::vector-per-message baseline.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include <oc/hal/net/Frame.hpp>
+#include <oc/hal/net/LoopbackTransport.hpp>
+
+#include "BenchUtil.hpp"
+
+namespace {
+
+std::atomic<uint64_t> gHeapAllocations{0};
+
+void* countedAlloc(size_t size) {
+    gHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+}  // namespace
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+
+namespace oc::hal::net::bench {
+namespace {
+
+constexpr size_t kBurst = 32;
+
+/// Frame sizes cycled through: inline, pooled, pooled (MTU-sized)
+constexpr size_t kFrameSizes[] = {16, 200, 1400};
+
+/**
+ * @brief memory_resource decorator counting allocate() calls
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream) : upstream_(upstream) {}
+
+    uint64_t allocations() const { return allocations_; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        allocations_++;
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        upstream_->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream_;
+    uint64_t allocations_ = 0;
+};
+
+/**
+ * @brief Preallocated arena with a recycling pool on top
+ *
+ * Transports get &pool; the arena only sees the pool's chunk refills.
+ */
+struct Arena {
+    static constexpr size_t kSize = 4 << 20;
+
+    Arena() : buffer(kSize), monotonic(buffer.data(), buffer.size()), counting(&monotonic),
+              pool(&counting) {}
+
+    std::vector<std::byte> buffer;
+    std::pmr::monotonic_buffer_resource monotonic;
+    CountingResource counting;
+    std::pmr::unsynchronized_pool_resource pool;
+};
+
+void reportAllocations(benchmark::State& state, uint64_t heapAllocs, uint64_t arenaAllocs,
+                       uint64_t frames) {
+    state.counters["heap_allocs_per_frame"] =
+        frames > 0 ? static_cast<double>(heapAllocs) / static_cast<double>(frames) : 0.0;
+    state.counters["arena_allocs"] = static_cast<double>(arenaAllocs);
+    state.SetItemsProcessed(static_cast<int64_t>(frames));
+}
+
+void BM_UdpSteadyStateAllocations(benchmark::State& state) {
+    Arena arena;
+
+    UdpConfig config;
+    config.maxFramesPerUpdate = kBurst;
+    config.memoryResource = &arena.pool;
+    UdpLoopbackPair pair;
+    if (!pair.open(config)) {
+        state.SkipWithError("loopback sockets unavailable");
+        return;
+    }
+
+    uint64_t received = 0;
+    pair.b->setOnReceive([&](const uint8_t*, size_t) { received++; });
+    uint8_t frame[kFrameSizes[2]] = {};
+
+    const uint64_t heapBefore = gHeapAllocations.load(std::memory_order_relaxed);
+    const uint64_t arenaBefore = arena.counting.allocations();
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBurst; ++i) {
+            pair.a->send(frame, kFrameSizes[i % 3]);
+        }
+        pair.b->update();
+    }
+    reportAllocations(state, gHeapAllocations.load(std::memory_order_relaxed) - heapBefore,
+                      arena.counting.allocations() - arenaBefore, received);
+}
+BENCHMARK(BM_UdpSteadyStateAllocations);
+
+void BM_LoopbackSteadyStateAllocations(benchmark::State& state) {
+    Arena arena;
+
+    LoopbackConfig config;
+    config.capacity = kBurst;
+    config.memoryResource = &arena.pool;
+    LoopbackTransportPair pair(config);
+
+    uint64_t received = 0;
+    pair.b().setOnReceive([&](const uint8_t*, size_t) { received++; });
+    uint8_t frame[kFrameSizes[2]] = {};
+
+    const uint64_t heapBefore = gHeapAllocations.load(std::memory_order_relaxed);
+    const uint64_t arenaBefore = arena.counting.allocations();
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBurst; ++i) {
+            pair.a().send(frame, kFrameSizes[i % 3]);
+        }
+        pair.b().update();
+    }
+    reportAllocations(state, gHeapAllocations.load(std::memory_order_relaxed) - heapBefore,
+                      arena.counting.allocations() - arenaBefore, received);
+}
+BENCHMARK(BM_LoopbackSteadyStateAllocations);
+
+/// Offline buffering as WebSocketTransport does it: pmr deque of pooled Frames
+void BM_FrameQueueAllocations(benchmark::State& state) {
+    Arena arena;
+    FramePool pool(kBurst, &arena.pool);
+    std::pmr::deque<Frame> queue(&arena.pool);
+
+    uint8_t frame[kFrameSizes[2]] = {};
+    uint64_t frames = 0;
+    uint64_t heapBefore = 0;
+    uint64_t arenaBefore = 0;
+    bool warm = false;
+
+    for (auto _ : state) {
+        if (!warm) {
+            // First burst fills the pool and the deque's block map
+            state.PauseTiming();
+            for (size_t i = 0; i < kBurst; ++i) {
+                queue.emplace_back(frame, kFrameSizes[i % 3], pool);
+            }
+            queue.clear();
+            heapBefore = gHeapAllocations.load(std::memory_order_relaxed);
+            arenaBefore = arena.counting.allocations();
+            warm = true;
+            state.ResumeTiming();
+        }
+        for (size_t i = 0; i < kBurst; ++i) {
+            queue.emplace_back(frame, kFrameSizes[i % 3], pool);
+        }
+        while (!queue.empty()) {
+            benchmark::DoNotOptimize(queue.front().data());
+            queue.pop_front();
+        }
+        frames += kBurst;
+    }
+    reportAllocations(state, gHeapAllocations.load(std::memory_order_relaxed) - heapBefore,
+                      arena.counting.allocations() - arenaBefore, frames);
+}
+BENCHMARK(BM_FrameQueueAllocations);
+
+/// Baseline: one std::vector per queued message
+void BM_VectorQueueAllocations(benchmark::State& state) {
+    std::deque<std::vector<uint8_t>> queue;
+    uint8_t frame[kFrameSizes[2]] = {};
+    uint64_t frames = 0;
+
+    const uint64_t heapBefore = gHeapAllocations.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBurst; ++i) {
+            queue.emplace_back(frame, frame + kFrameSizes[i % 3]);
+        }
+        while (!queue.empty()) {
+            benchmark::DoNotOptimize(queue.front().data());
+            queue.pop_front();
+        }
+        frames += kBurst;
+    }
+    reportAllocations(state, gHeapAllocations.load(std::memory_order_relaxed) - heapBefore,
+                      0, frames);
+}
+BENCHMARK(BM_VectorQueueAllocations);
+
+}  // namespace
+}  // namespace oc::hal::net::bench
@@ -0,0 +1,8 @@
+/**
+ * @file BenchMain.cpp
+ * @brief Entry point of oc-hal-net-bench (all BM_* files link into one binary)
+ */
+
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();
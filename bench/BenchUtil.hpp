@@ -0,0 +1,76 @@
+#pragma once
+
+/**
+ * @file BenchUtil.hpp
+ * @brief Shared helpers for the oc-hal-net benchmarks
+ */
+
+#include <chrono>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <oc/hal/net/LatencyHistogram.hpp>
+
+#include "UdpLoopbackPair.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+#endif
+
+namespace oc::hal::net::bench {
+
+/**
+ * @brief Cheap constant-rate tick counter (TSC on x86, CNTVCT on AArch64)
+ *
+ * These count reference ticks, not core cycles: the invariant TSC runs at
+ * the nominal base frequency regardless of turbo or power states, and
+ * CNTVCT typically at tens of MHz (see CNTFRQ_EL0). Compare ticks_per_frame
+ * only between runs on the same machine.
+ *
+ * Returns 0 on other architectures; callers skip the ticks counter then.
+ */
+inline uint64_t readTickCounter() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return 0;
+#endif
+}
+
+inline uint64_t nowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief Publish a LatencyHistogram as benchmark counters (ns)
+ */
+inline void reportLatency(benchmark::State& state, const LatencyHistogram& hist) {
+    LatencySummary s = hist.summary();
+    state.counters["p50_ns"] = static_cast<double>(s.p50Ns);
+    state.counters["p99_ns"] = static_cast<double>(s.p99Ns);
+    state.counters["p999_ns"] = static_cast<double>(s.p999Ns);
+    state.counters["max_ns"] = static_cast<double>(s.maxNs);
+    state.counters["mean_ns"] = static_cast<double>(s.meanNs);
+}
+
+/**
+ * @brief Publish reference ticks per item from a readTickCounter() delta
+ */
+inline void reportTicks(benchmark::State& state, uint64_t ticks, uint64_t items) {
+    if (ticks > 0 && items > 0) {
+        state.counters["ticks_per_frame"] =
+            static_cast<double>(ticks) / static_cast<double>(items);
+    }
+}
+
+}  // namespace oc::hal::net::bench
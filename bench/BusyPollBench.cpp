@@ -0,0 +1,121 @@
+/**
+ * @file BusyPollBench.cpp
+ * @brief Receive wakeup latency and CPU cost: update() polling vs waitAndUpdate()
+ *
+ * A ping is sent every gap µs to an echo thread; both ends wait for
+ * frames in the same mode:
+ *
+ * - Update:   update() from a 1 ms main loop (the default integration)
+ * - Block:    waitAndUpdate() with spinIdleUs = 0 (blocking poll())
+ * - Adaptive: spins for 200 µs after each frame, then blocks
+ * - Spin:     spins through every gap (burns a core per waiting thread)
+ *
+ * Counters: p50/p99/p999/max round-trip ns and cpu_pct (process CPU time
+ * over wall time for both threads, so up to 200%). Busy polling in the
+ * NIC driver (busyPollUs) only changes results on real interfaces; on
+ * loopback the spin phase is what is being measured.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <thread>
+
+#include "BenchUtil.hpp"
+
+namespace oc::hal::net::bench {
+namespace {
+
+enum class WaitMode { Update, Block, Adaptive, Spin };
+
+/// Main-loop period of the Update mode
+constexpr auto kLoopPeriod = std::chrono::milliseconds(1);
+
+/// Longest wait for a reply before the round trip counts as lost (ms)
+constexpr uint32_t kReplyTimeoutMs = 100;
+
+/// Wait for frames on transport in mode, give up after timeoutMs
+void waitOnce(UdpTransport& transport, WaitMode mode, uint32_t timeoutMs) {
+    if (mode == WaitMode::Update) {
+        std::this_thread::sleep_for(kLoopPeriod);
+        transport.update();
+    } else {
+        transport.waitAndUpdate(timeoutMs);
+    }
+}
+
+void BM_UdpWaitMode(benchmark::State& state) {
+    const auto mode = static_cast<WaitMode>(state.range(0));
+    const auto gap = std::chrono::microseconds(state.range(1));
+
+    // Two spinning threads on one core just take turns at scheduler-tick pace
+    if ((mode == WaitMode::Adaptive || mode == WaitMode::Spin) &&
+        std::thread::hardware_concurrency() < 2) {
+        state.SkipWithError("spinning modes need at least 2 cores");
+        return;
+    }
+
+    UdpConfig config;
+    config.busyPollUs = 50;
+    config.spinIdleUs = mode == WaitMode::Adaptive ? 200
+                      : mode == WaitMode::Spin     ? 1000000
+                                                   : 0;
+    UdpLoopbackPair pair;
+    if (!pair.open(config)) {
+        state.SkipWithError("loopback sockets unavailable");
+        return;
+    }
+
+    UdpTransport& echo = *pair.b;
+    echo.setOnReceive([&echo](const uint8_t* data, size_t len) { echo.send(data, len); });
+    std::atomic<bool> stop{false};
+    std::thread echoThread([&] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            waitOnce(echo, mode, 10);
+        }
+    });
+
+    bool replied = false;
+    pair.a->setOnReceive([&](const uint8_t*, size_t) { replied = true; });
+
+    uint8_t frame[16] = {};
+    LatencyHistogram rtt;
+    std::clock_t cpuStart = std::clock();
+    uint64_t wallStart = nowNs();
+
+    for (auto _ : state) {
+        std::this_thread::sleep_for(gap);
+
+        replied = false;
+        uint64_t startNs = nowNs();
+        pair.a->send(frame, sizeof(frame));
+        while (!replied && nowNs() - startNs < kReplyTimeoutMs * 1000000ull) {
+            waitOnce(*pair.a, mode, kReplyTimeoutMs);
+        }
+        if (!replied) {
+            state.SkipWithError("echo lost");
+            break;
+        }
+        rtt.record(nowNs() - startNs);
+    }
+
+    double cpuNs = static_cast<double>(std::clock() - cpuStart) * 1e9 / CLOCKS_PER_SEC;
+    double wallNs = static_cast<double>(nowNs() - wallStart);
+    stop.store(true, std::memory_order_relaxed);
+    echoThread.join();
+
+    reportLatency(state, rtt);
+    state.counters["cpu_pct"] = wallNs > 0 ? 100.0 * cpuNs / wallNs : 0.0;
+}
+BENCHMARK(BM_UdpWaitMode)
+    ->ArgNames({"mode", "gap_us"})
+    ->ArgsProduct({{static_cast<int64_t>(WaitMode::Update),
+                    static_cast<int64_t>(WaitMode::Block),
+                    static_cast<int64_t>(WaitMode::Adaptive),
+                    static_cast<int64_t>(WaitMode::Spin)},
+                   {100, 1000}})
+    ->Iterations(2000)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace oc::hal::net::bench
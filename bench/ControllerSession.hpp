@@ -0,0 +1,147 @@
+#pragma once
+
+/**
+ * @file ControllerSession.hpp
+ * @brief Representative controller traffic used for PGO training
+ *
+ * A session is a flat list of events replayed in order: single frames
+ * (knob sweeps), bursts (state dumps after a page change) and
+ * reconnects. generateControllerSession() builds a deterministic one
+ * modelled on a typical oc-bridge session, so profiles are reproducible;
+ * loadControllerSession() derives one from a real pcapng capture.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <oc/hal/net/ReplayTransport.hpp>
+
+namespace oc::hal::net::bench {
+
+struct SessionEvent {
+    enum class Kind : uint8_t {
+        Frame,      ///< One frame, sent and awaited (interactive control)
+        Burst,      ///< count frames sent back-to-back, then drained
+        Reconnect   ///< Tear down and re-create both endpoints
+    };
+
+    Kind kind = Kind::Frame;
+    uint16_t size = 0;   ///< Frame size in bytes
+    uint16_t count = 1;  ///< Frames in a Burst
+};
+
+using ControllerSession = std::vector<SessionEvent>;
+
+/**
+ * @brief Deterministic synthetic session
+ *
+ * Each cycle: a page change (state-dump burst of 48-256 B frames), a set
+ * of knob sweeps (6-12 B parameter updates), a meter/waveform burst, and
+ * every fourth cycle a reconnect.
+ */
+inline ControllerSession generateControllerSession(uint32_t cycles = 40, uint32_t seed = 0x0C0C) {
+    uint32_t state = seed ? seed : 1;
+    auto next = [&state](uint32_t bound) {
+        // xorshift32: identical sequence on every platform
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state % bound;
+    };
+
+    ControllerSession session;
+    for (uint32_t cycle = 0; cycle < cycles; ++cycle) {
+        // Page change: dump of all parameters on the new page
+        for (int i = 0; i < 8; ++i) {
+            session.push_back({SessionEvent::Kind::Burst,
+                               static_cast<uint16_t>(48 + next(208)),
+                               static_cast<uint16_t>(16 + next(16))});
+        }
+
+        // Knob sweeps: a few hundred small parameter updates
+        uint32_t sweeps = 200 + next(200);
+        for (uint32_t i = 0; i < sweeps; ++i) {
+            session.push_back({SessionEvent::Kind::Frame,
+                               static_cast<uint16_t>(6 + next(7)), 1});
+        }
+
+        // Meter / waveform stream
+        session.push_back({SessionEvent::Kind::Burst, 512, 24});
+
+        if (cycle % 4 == 3) {
+            session.push_back({SessionEvent::Kind::Reconnect, 0, 0});
+        }
+    }
+    return session;
+}
+
+/**
+ * @brief Session from the Tx frames of a CaptureTransport recording
+ *
+ * Frames less than burstGapNs apart are grouped into one Burst (sized by
+ * their average length), gaps longer than reconnectGapNs become a
+ * Reconnect. Returns an empty session if the file cannot be read.
+ */
+inline ControllerSession loadControllerSession(const std::string& path,
+                                               uint64_t burstGapNs = 200000,
+                                               uint64_t reconnectGapNs = 2000000000) {
+    struct Captured {
+        uint64_t timestampNs;
+        size_t size;
+    };
+    std::vector<Captured> frames;
+
+    ReplayConfig config;
+    config.path = path;
+    config.direction = CaptureDirection::Tx;
+    config.speed = 0.0;
+    ReplayTransport replay(config);
+    if (!replay.init().isOk()) {
+        return {};
+    }
+    replay.setOnReceive([&](const uint8_t*, size_t len) {
+        frames.push_back({replay.currentTimestampNs(), std::min<size_t>(len, 2048)});
+    });
+    replay.update();
+
+    ControllerSession session;
+    for (size_t i = 0; i < frames.size();) {
+        if (i > 0 && frames[i].timestampNs - frames[i - 1].timestampNs > reconnectGapNs) {
+            session.push_back({SessionEvent::Kind::Reconnect, 0, 0});
+        }
+
+        // Group back-to-back frames into one burst
+        size_t end = i + 1;
+        size_t bytes = frames[i].size;
+        while (end < frames.size() && end - i < UINT16_MAX &&
+               frames[end].timestampNs - frames[end - 1].timestampNs < burstGapNs) {
+            bytes += frames[end].size;
+            end++;
+        }
+
+        size_t count = end - i;
+        SessionEvent event;
+        event.kind = count > 1 ? SessionEvent::Kind::Burst : SessionEvent::Kind::Frame;
+        event.size = static_cast<uint16_t>(bytes / count);
+        event.count = static_cast<uint16_t>(count);
+        session.push_back(event);
+        i = end;
+    }
+    return session;
+}
+
+/// Total frames in a session
+inline size_t sessionFrameCount(const ControllerSession& session) {
+    size_t frames = 0;
+    for (const SessionEvent& event : session) {
+        if (event.kind != SessionEvent::Kind::Reconnect) {
+            frames += event.count;
+        }
+    }
+    return frames;
+}
+
+}  // namespace oc::hal::net::bench
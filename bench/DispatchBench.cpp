@@ -0,0 +1,94 @@
+/**
+ * @file DispatchBench.cpp
+ * @brief Per-frame receive dispatch cost: std::function callback vs. poll()
+ *
+ * Runs over LoopbackTransportPair so no syscall hides the difference.
+ * The handler does a small amount of work (checksum) that the compiler
+ * can only fuse into the receive loop in the poll() variant.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <oc/hal/net/LoopbackTransport.hpp>
+
+#include "BenchUtil.hpp"
+
+namespace oc::hal::net::bench {
+namespace {
+
+constexpr size_t kBurst = 256;
+constexpr size_t kFrameSize = 16;
+
+struct Consumer {
+    uint64_t frames = 0;
+    uint64_t sum = 0;
+
+    void operator()(const uint8_t* data, size_t length) {
+        frames++;
+        sum += data[0] + data[length - 1];
+    }
+};
+
+template <typename Receive>
+void runDispatch(benchmark::State& state, LoopbackTransportPair& pair, Consumer& consumer,
+                 Receive&& receive) {
+    uint8_t frame[kFrameSize] = {1};
+    uint64_t ticks = 0;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < kBurst; ++i) {
+            pair.a().send(frame, sizeof(frame));
+        }
+        uint64_t start = readTickCounter();
+        receive();
+        ticks += readTickCounter() - start;
+    }
+
+    benchmark::DoNotOptimize(consumer.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(consumer.frames));
+    reportTicks(state, ticks, consumer.frames);
+}
+
+void BM_DispatchStdFunction(benchmark::State& state) {
+    LoopbackConfig config;
+    config.capacity = kBurst;
+    LoopbackTransportPair pair(config);
+
+    Consumer consumer;
+    pair.b().setOnReceive([&consumer](const uint8_t* data, size_t length) {
+        consumer(data, length);
+    });
+
+    runDispatch(state, pair, consumer, [&] { pair.b().update(); });
+}
+BENCHMARK(BM_DispatchStdFunction);
+
+void BM_DispatchVirtualUpdate(benchmark::State& state) {
+    LoopbackConfig config;
+    config.capacity = kBurst;
+    LoopbackTransportPair pair(config);
+
+    Consumer consumer;
+    interface::ITransport& transport = pair.b();
+    transport.setOnReceive([&consumer](const uint8_t* data, size_t length) {
+        consumer(data, length);
+    });
+
+    // Through the interface, as protocol code holding an ITransport& does
+    runDispatch(state, pair, consumer, [&] { transport.update(); });
+}
+BENCHMARK(BM_DispatchVirtualUpdate);
+
+void BM_DispatchPoll(benchmark::State& state) {
+    LoopbackConfig config;
+    config.capacity = kBurst;
+    LoopbackTransportPair pair(config);
+
+    Consumer consumer;
+    runDispatch(state, pair, consumer, [&] { pair.b().poll(consumer); });
+}
+BENCHMARK(BM_DispatchPoll);
+
+}  // namespace
+}  // namespace oc::hal::net::bench
@@ -0,0 +1,74 @@
+/**
+ * @file LoopbackBench.cpp
+ * @brief LoopbackTransportPair throughput: frame handling cost without syscalls
+ *
+ * Baseline for protocol-layer benchmarks - whatever these numbers are,
+ * a transport-agnostic consumer cannot go faster.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <oc/hal/net/LoopbackTransport.hpp>
+
+#include "BenchUtil.hpp"
+
+namespace oc::hal::net::bench {
+namespace {
+
+constexpr size_t kBurst = 64;
+
+void BM_LoopbackThroughput(benchmark::State& state) {
+    const size_t frameSize = static_cast<size_t>(state.range(0));
+
+    LoopbackConfig config;
+    config.maxFrameSize = frameSize;
+    config.capacity = kBurst;
+    LoopbackTransportPair pair(config);
+
+    uint64_t received = 0;
+    pair.b().setOnReceive([&](const uint8_t* data, size_t) {
+        benchmark::DoNotOptimize(data);
+        received++;
+    });
+
+    std::vector<uint8_t> frame(frameSize, 0xA5);
+    uint64_t ticks = 0;
+
+    for (auto _ : state) {
+        uint64_t start = readTickCounter();
+        for (size_t i = 0; i < kBurst; ++i) {
+            pair.a().send(frame.data(), frame.size());
+        }
+        pair.b().update();
+        ticks += readTickCounter() - start;
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(received));
+    state.SetBytesProcessed(static_cast<int64_t>(received * frameSize));
+    reportTicks(state, ticks, received);
+}
+BENCHMARK(BM_LoopbackThroughput)->RangeMultiplier(2)->Range(8, 8 << 10);
+
+void BM_LoopbackPingPong(benchmark::State& state) {
+    LoopbackTransportPair pair;
+
+    LoopbackTransport& echo = pair.b();
+    echo.setOnReceive([&echo](const uint8_t* data, size_t len) { echo.send(data, len); });
+
+    uint64_t replies = 0;
+    pair.a().setOnReceive([&](const uint8_t*, size_t) { replies++; });
+
+    uint8_t frame[16] = {};
+    for (auto _ : state) {
+        pair.a().send(frame, sizeof(frame));
+        pair.b().update();
+        pair.a().update();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(replies));
+}
+BENCHMARK(BM_LoopbackPingPong);
+
+}  // namespace
+}  // namespace oc::hal::net::bench
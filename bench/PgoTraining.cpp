@@ -0,0 +1,134 @@
+/**
+ * @file PgoTraining.cpp
+ * @brief PGO training workload: replays a controller session over UDP loopback
+ *
+ * Sends every frame of a ControllerSession from one UdpTransport to a
+ * second one that echoes it back, exercising the same send/update paths
+ * as a real app talking to oc-bridge. Also used to measure the PGO gain:
+ * the median wall time over N repetitions, and its spread, are printed as
+ *
+ * ```
+ * oc-hal-net-pgo-train: frames=<n> median_ns=<t> min_ns=<lo> max_ns=<hi> ns_per_frame=<x>
+ * ```
+ *
+ * which cmake/PgoWorkflow.cmake parses to compare builds. The workload is
+ * dominated by loopback syscalls, so a gain smaller than the min..max
+ * spread is noise.
+ *
+ * Usage: oc-hal-net-pgo-train [repetitions] [capture.pcapng]
+ *
+ * With a capture (recorded by CaptureTransport), its Tx frames replace
+ * the synthetic session.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "ControllerSession.hpp"
+#include "UdpLoopbackPair.hpp"
+
+using namespace oc::hal::net;
+using namespace oc::hal::net::bench;
+
+namespace {
+
+/// Poll iterations before an echo is considered lost
+constexpr int kMaxSpins = 100000;
+
+class SessionReplayer {
+public:
+    bool open() {
+        UdpConfig config;
+        config.recvBufferSize = 2048;
+        if (!pair_.open(config)) {
+            return false;
+        }
+        UdpTransport& echo = *pair_.b;
+        echo.setOnReceive([&echo](const uint8_t* data, size_t len) { echo.send(data, len); });
+        pair_.a->setOnReceive([this](const uint8_t*, size_t) { replies_++; });
+        return true;
+    }
+
+    /// Replay all events, returns false if the loopback sockets failed
+    bool run(const ControllerSession& session) {
+        std::vector<uint8_t> frame(2048);
+        uint8_t fill = 0;
+
+        for (const SessionEvent& event : session) {
+            if (event.kind == SessionEvent::Kind::Reconnect) {
+                if (!open()) {
+                    return false;
+                }
+                continue;
+            }
+
+            std::fill(frame.begin(), frame.begin() + event.size, fill++);
+            uint64_t target = replies_ + event.count;
+            for (uint16_t i = 0; i < event.count; ++i) {
+                pair_.a->send(frame.data(), event.size);
+            }
+            for (int spins = 0; replies_ < target && spins < kMaxSpins; ++spins) {
+                pair_.b->update();
+                pair_.a->update();
+            }
+            // Resynchronize after a loss so one drop does not stall the rest
+            replies_ = std::max(replies_, target);
+        }
+        return true;
+    }
+
+private:
+    UdpLoopbackPair pair_;
+    uint64_t replies_ = 0;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int repetitions = argc > 1 ? std::max(1, std::atoi(argv[1])) : 5;
+
+    ControllerSession session;
+    if (argc > 2) {
+        session = loadControllerSession(argv[2]);
+        if (session.empty()) {
+            std::fprintf(stderr, "oc-hal-net-pgo-train: no frames in %s\n", argv[2]);
+            return 1;
+        }
+    } else {
+        session = generateControllerSession();
+    }
+    size_t frames = sessionFrameCount(session);
+
+    std::vector<uint64_t> times;
+    times.reserve(static_cast<size_t>(repetitions));
+    for (int rep = 0; rep < repetitions; ++rep) {
+        SessionReplayer replayer;
+        if (!replayer.open()) {
+            std::fprintf(stderr, "oc-hal-net-pgo-train: loopback sockets unavailable\n");
+            return 1;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        if (!replayer.run(session)) {
+            std::fprintf(stderr, "oc-hal-net-pgo-train: reconnect failed\n");
+            return 1;
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        times.push_back(static_cast<uint64_t>(elapsed));
+    }
+
+    std::sort(times.begin(), times.end());
+    uint64_t median = times[times.size() / 2];
+    std::printf("oc-hal-net-pgo-train: frames=%zu median_ns=%llu min_ns=%llu max_ns=%llu "
+                "ns_per_frame=%.1f\n",
+                frames, static_cast<unsigned long long>(median),
+                static_cast<unsigned long long>(times.front()),
+                static_cast<unsigned long long>(times.back()),
+                static_cast<double>(median) / static_cast<double>(frames));
+    return 0;
+}
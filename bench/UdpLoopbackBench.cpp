@@ -0,0 +1,122 @@
+/**
+ * @file UdpLoopbackBench.cpp
+ * @brief UdpTransport throughput and latency over 127.0.0.1
+ *
+ * Run with machine-readable output for regression tracking:
+ *
+ * ```
+ * oc-hal-net-bench --benchmark_format=json --benchmark_out=udp.json
+ * ```
+ *
+ * Counters: items/bytes per second (frames/s, B/s), ticks_per_frame
+ * (sender + receiver work per frame, in reference-clock ticks - see
+ * readTickCounter()), p50/p99/p999/max round-trip ns.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "BenchUtil.hpp"
+
+namespace oc::hal::net::bench {
+namespace {
+
+/// Frames sent before the receiver drains them
+constexpr size_t kBurst = 32;
+
+/// Cap on a burst's payload so it stays well below the default SO_RCVBUF
+constexpr size_t kBurstBytes = 64 << 10;
+
+/// Poll iterations before a ping-pong round trip is considered lost
+constexpr int kMaxSpins = 1000000;
+
+void BM_UdpThroughput(benchmark::State& state) {
+    const size_t frameSize = static_cast<size_t>(state.range(0));
+
+    UdpConfig config;
+    config.recvBufferSize = frameSize;
+    UdpLoopbackPair pair;
+    if (!pair.open(config)) {
+        state.SkipWithError("loopback sockets unavailable");
+        return;
+    }
+
+    uint64_t received = 0;
+    pair.b->setOnReceive([&](const uint8_t*, size_t) { received++; });
+
+    std::vector<uint8_t> frame(frameSize, 0xA5);
+    const size_t burst = std::max<size_t>(1, std::min(kBurst, kBurstBytes / frameSize));
+    uint64_t ticks = 0;
+
+    for (auto _ : state) {
+        uint64_t start = readTickCounter();
+        uint64_t target = received + burst;
+        for (size_t i = 0; i < burst; ++i) {
+            pair.a->send(frame.data(), frame.size());
+        }
+        // Loopback delivery is synchronous, bail out if frames were lost
+        for (size_t spins = 0; received < target && spins < burst * 4; ++spins) {
+            pair.b->update();
+        }
+        ticks += readTickCounter() - start;
+    }
+
+    uint64_t frames = static_cast<uint64_t>(state.iterations()) * burst;
+    state.SetItemsProcessed(static_cast<int64_t>(received));
+    state.SetBytesProcessed(static_cast<int64_t>(received * frameSize));
+    state.counters["lost"] = static_cast<double>(frames - received);
+    reportTicks(state, ticks, received);
+}
+BENCHMARK(BM_UdpThroughput)->RangeMultiplier(2)->Range(8, 8 << 10);
+
+void BM_UdpPingPong(benchmark::State& state) {
+    const size_t frameSize = static_cast<size_t>(state.range(0));
+
+    UdpConfig config;
+    config.recvBufferSize = frameSize;
+    UdpLoopbackPair pair;
+    if (!pair.open(config)) {
+        state.SkipWithError("loopback sockets unavailable");
+        return;
+    }
+
+    // b echoes every frame back to a
+    UdpTransport& echo = *pair.b;
+    echo.setOnReceive([&echo](const uint8_t* data, size_t len) { echo.send(data, len); });
+
+    bool replied = false;
+    pair.a->setOnReceive([&](const uint8_t*, size_t) { replied = true; });
+
+    std::vector<uint8_t> frame(frameSize, 0x5A);
+    LatencyHistogram rtt;
+    uint64_t ticks = 0;
+
+    for (auto _ : state) {
+        replied = false;
+        uint64_t startTicks = readTickCounter();
+        uint64_t startNs = nowNs();
+
+        pair.a->send(frame.data(), frame.size());
+        for (int spins = 0; !replied && spins < kMaxSpins; ++spins) {
+            pair.b->update();
+            pair.a->update();
+        }
+        if (!replied) {
+            state.SkipWithError("echo lost");
+            break;
+        }
+
+        rtt.record(nowNs() - startNs);
+        ticks += readTickCounter() - startTicks;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(frameSize) * 2);
+    reportLatency(state, rtt);
+    reportTicks(state, ticks, static_cast<uint64_t>(state.iterations()));
+}
+BENCHMARK(BM_UdpPingPong)->Arg(8)->Arg(64)->Arg(512)->Arg(8 << 10);
+
+}  // namespace
+}  // namespace oc::hal::net::bench
@@ -0,0 +1,49 @@
+#pragma once
+
+/**
+ * @file UdpLoopbackPair.hpp
+ * @brief Two connected UdpTransports on 127.0.0.1 for benchmarks and training
+ */
+
+#include <cstdint>
+#include <memory>
+
+#include <oc/hal/net/UdpTransport.hpp>
+
+namespace oc::hal::net::bench {
+
+/**
+ * @brief Two UdpTransports on 127.0.0.1 addressing each other
+ *
+ * Ports are picked by the OS: the first endpoint is bound once to learn
+ * a free port, then re-created on that port aimed at the second one.
+ */
+struct UdpLoopbackPair {
+    std::unique_ptr<UdpTransport> a;
+    std::unique_ptr<UdpTransport> b;
+
+    bool open(const UdpConfig& base = UdpConfig{}) {
+        UdpConfig probe = base;
+        probe.localPort = 0;
+        auto first = std::make_unique<UdpTransport>(probe);
+        if (!first->init().isOk()) return false;
+        uint16_t portA = first->localPort();
+
+        UdpConfig configB = base;
+        configB.host = "127.0.0.1";
+        configB.port = portA;
+        configB.localPort = 0;
+        b = std::make_unique<UdpTransport>(configB);
+        if (!b->init().isOk()) return false;
+
+        first.reset();
+        UdpConfig configA = base;
+        configA.host = "127.0.0.1";
+        configA.port = b->localPort();
+        configA.localPort = portA;
+        a = std::make_unique<UdpTransport>(configA);
+        return a->init().isOk();
+    }
+};
+
+}  // namespace oc::hal::net::bench
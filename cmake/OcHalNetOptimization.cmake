@@ -0,0 +1,65 @@
+# Optimization flags shared by oc-hal-net and its benchmarks.
+#
+# oc_hal_net_optimize(<target>) applies, according to the cache options:
+#   OC_HAL_NET_LTO          interprocedural optimization (if supported)
+#   OC_HAL_NET_NATIVE_ARCH  -march=native
+#   OC_HAL_NET_PGO          OFF | GENERATE | USE
+#   OC_HAL_NET_PGO_DIR      profile directory (GENERATE writes, USE reads)
+#
+# PGO with Clang expects ${OC_HAL_NET_PGO_DIR}/default.profdata, produced
+# from the raw profiles with llvm-profdata merge. GCC reads the .gcda
+# files directly from the directory. A source compiled without matching
+# profile data is reported (-Wmissing-profile, -Wprofile-instr-unprofiled)
+# rather than silently built as plain -O2.
+
+option(OC_HAL_NET_LTO "Enable link-time optimization" OFF)
+option(OC_HAL_NET_NATIVE_ARCH "Tune for the build machine (-march=native)" OFF)
+set(OC_HAL_NET_PGO "OFF" CACHE STRING "Profile-guided optimization phase")
+set_property(CACHE OC_HAL_NET_PGO PROPERTY STRINGS OFF GENERATE USE)
+set(OC_HAL_NET_PGO_DIR "${CMAKE_BINARY_DIR}/pgo-profiles" CACHE PATH
+    "Directory for PGO profiles")
+
+if(OC_HAL_NET_LTO)
+    include(CheckIPOSupported)
+    check_ipo_supported(RESULT _oc_hal_net_ipo OUTPUT _oc_hal_net_ipo_msg LANGUAGES CXX)
+    if(NOT _oc_hal_net_ipo)
+        message(WARNING "LTO not supported by this toolchain: ${_oc_hal_net_ipo_msg}")
+    endif()
+endif()
+
+if(NOT OC_HAL_NET_PGO STREQUAL "OFF")
+    if(NOT CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+        message(FATAL_ERROR "OC_HAL_NET_PGO requires GCC or Clang")
+    endif()
+    if(NOT OC_HAL_NET_PGO MATCHES "^(GENERATE|USE)$")
+        message(FATAL_ERROR "OC_HAL_NET_PGO must be OFF, GENERATE or USE")
+    endif()
+endif()
+
+function(oc_hal_net_optimize target)
+    if(OC_HAL_NET_LTO AND _oc_hal_net_ipo)
+        set_property(TARGET ${target} PROPERTY INTERPROCEDURAL_OPTIMIZATION TRUE)
+    endif()
+
+    if(OC_HAL_NET_NATIVE_ARCH AND CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+        target_compile_options(${target} PRIVATE -march=native)
+    endif()
+
+    if(OC_HAL_NET_PGO STREQUAL "GENERATE")
+        if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+            set(_flags "-fprofile-instr-generate=${OC_HAL_NET_PGO_DIR}/%m-%p.profraw")
+        else()
+            set(_flags "-fprofile-generate=${OC_HAL_NET_PGO_DIR}" -fprofile-update=atomic)
+        endif()
+        target_compile_options(${target} PRIVATE ${_flags})
+        target_link_options(${target} PUBLIC ${_flags})
+    elseif(OC_HAL_NET_PGO STREQUAL "USE")
+        if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+            set(_flags "-fprofile-instr-use=${OC_HAL_NET_PGO_DIR}/default.profdata"
+                       -Wprofile-instr-unprofiled)
+        else()
+            set(_flags "-fprofile-use=${OC_HAL_NET_PGO_DIR}" -fprofile-correction)
+        endif()
+        target_compile_options(${target} PRIVATE ${_flags})
+    endif()
+endfunction()
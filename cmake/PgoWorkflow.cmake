@@ -0,0 +1,136 @@
+# Profile-guided optimization workflow for oc-hal-net
+#
+#   cmake -DOC_FRAMEWORK_DIR=/path/to/framework/src -P cmake/PgoWorkflow.cmake
+#
+# Optional: -DPGO_BUILD_ROOT=<dir> (default: build-pgo), -DPGO_REPETITIONS=<n>,
+#           -DPGO_CAPTURE=<session.pcapng> (recorded session instead of the synthetic one),
+#           -DPGO_GENERATOR=<generator>, -DCMAKE_CXX_COMPILER=<compiler>
+#
+# Steps:
+#   1. baseline  - Release build, OC_HAL_NET_PGO=OFF, timed training run
+#   2. generate  - instrumented build, training run writes the profiles
+#   3. use       - optimized build from the profiles, timed training run
+# and prints the median times of (1) and (3) with their spread.
+#
+# Generate and use share one build tree (<PGO_BUILD_ROOT>/pgo): GCC names
+# each .gcda after the object path, so a second tree would never find its
+# profiles. The workflow fails if the training run wrote no profiles or
+# the use build reports missing profile data for UdpTransport.cpp, the
+# code the training workload drives. The optimized library is left in
+# <PGO_BUILD_ROOT>/pgo.
+
+cmake_minimum_required(VERSION 3.16)
+
+get_filename_component(_source_dir "${CMAKE_CURRENT_LIST_DIR}/.." ABSOLUTE)
+
+if(NOT OC_FRAMEWORK_DIR)
+    message(FATAL_ERROR "Pass -DOC_FRAMEWORK_DIR=<oc framework include root>")
+endif()
+if(NOT PGO_BUILD_ROOT)
+    set(PGO_BUILD_ROOT "${_source_dir}/build-pgo")
+endif()
+if(NOT PGO_REPETITIONS)
+    set(PGO_REPETITIONS 11)
+endif()
+
+set(_profile_dir "${PGO_BUILD_ROOT}/profiles")
+set(_common_args
+    -DCMAKE_BUILD_TYPE=Release
+    -DOC_FRAMEWORK_DIR=${OC_FRAMEWORK_DIR}
+    -DOC_HAL_NET_BUILD_PGO_TRAINER=ON
+    -DOC_HAL_NET_PGO_DIR=${_profile_dir}
+)
+if(CMAKE_CXX_COMPILER)
+    list(APPEND _common_args -DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER})
+endif()
+if(PGO_GENERATOR)
+    list(APPEND _common_args -G ${PGO_GENERATOR})
+endif()
+
+# Sets _pgo_output to the command's stdout and stderr (compiler diagnostics)
+function(_pgo_run)
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE _rc OUTPUT_VARIABLE _out ERROR_VARIABLE _err)
+    if(NOT _rc EQUAL 0)
+        message(FATAL_ERROR "Command failed (${_rc}): ${ARGN}\n${_out}\n${_err}")
+    endif()
+    set(_pgo_output "${_out}${_err}" PARENT_SCOPE)
+endfunction()
+
+function(_pgo_build dir phase pgo_mode)
+    message(STATUS "PGO [${phase}] configure + build")
+    _pgo_run(${CMAKE_COMMAND} -S ${_source_dir} -B ${PGO_BUILD_ROOT}/${dir} ${_common_args}
+             -DOC_HAL_NET_PGO=${pgo_mode})
+    _pgo_run(${CMAKE_COMMAND} --build ${PGO_BUILD_ROOT}/${dir} --config Release --parallel)
+    set(_pgo_output "${_pgo_output}" PARENT_SCOPE)
+endfunction()
+
+# Runs the trainer, sets <prefix>_median/_min/_max (ns)
+function(_pgo_train dir phase prefix)
+    set(_trainer "")
+    foreach(_candidate bench/oc-hal-net-pgo-train bench/Release/oc-hal-net-pgo-train.exe
+                       bench/oc-hal-net-pgo-train.exe)
+        if(EXISTS "${PGO_BUILD_ROOT}/${dir}/${_candidate}")
+            set(_trainer "${PGO_BUILD_ROOT}/${dir}/${_candidate}")
+            break()
+        endif()
+    endforeach()
+    if(NOT _trainer)
+        message(FATAL_ERROR "oc-hal-net-pgo-train not found in ${PGO_BUILD_ROOT}/${dir}")
+    endif()
+    _pgo_run(${_trainer} ${PGO_REPETITIONS} ${PGO_CAPTURE})
+    string(STRIP "${_pgo_output}" _pgo_output)
+    message(STATUS "PGO [${phase}] ${_pgo_output}")
+    if(NOT _pgo_output MATCHES "median_ns=([0-9]+) min_ns=([0-9]+) max_ns=([0-9]+)")
+        message(FATAL_ERROR "Unexpected trainer output: ${_pgo_output}")
+    endif()
+    set(${prefix}_median ${CMAKE_MATCH_1} PARENT_SCOPE)
+    set(${prefix}_min ${CMAKE_MATCH_2} PARENT_SCOPE)
+    set(${prefix}_max ${CMAKE_MATCH_3} PARENT_SCOPE)
+endfunction()
+
+# 1. Baseline
+_pgo_build(baseline baseline OFF)
+_pgo_train(baseline baseline _baseline)
+
+# 2. Instrumented training run
+file(REMOVE_RECURSE "${_profile_dir}")
+file(MAKE_DIRECTORY "${_profile_dir}")
+_pgo_build(pgo generate GENERATE)
+_pgo_train(pgo generate _generate)
+
+file(GLOB_RECURSE _gcda_profiles "${_profile_dir}/*.gcda")
+file(GLOB _raw_profiles "${_profile_dir}/*.profraw")
+if(NOT _gcda_profiles AND NOT _raw_profiles)
+    message(FATAL_ERROR "Training run wrote no profiles to ${_profile_dir}")
+endif()
+if(_raw_profiles)
+    # Clang: merge raw profiles into the file OC_HAL_NET_PGO=USE expects
+    find_program(_profdata NAMES llvm-profdata llvm-profdata-18 llvm-profdata-17 llvm-profdata-16)
+    if(NOT _profdata)
+        message(FATAL_ERROR "llvm-profdata is required to merge Clang profiles")
+    endif()
+    _pgo_run(${_profdata} merge -output=${_profile_dir}/default.profdata ${_raw_profiles})
+endif()
+
+# 3. Optimized build, same tree so the profile names match the objects
+_pgo_build(pgo use USE)
+string(REGEX MATCHALL "[^\n]*(profile count data file not found|no profile data available)[^\n]*"
+       _missing "${_pgo_output}")
+if(_missing)
+    string(REPLACE ";" "\n" _missing_lines "${_missing}")
+    if(_missing_lines MATCHES "UdpTransport\\.cpp")
+        message(FATAL_ERROR "PGO use build consumed no profile for UdpTransport.cpp:\n"
+                            "${_missing_lines}")
+    endif()
+    message(WARNING "Sources built without profile data:\n${_missing_lines}")
+endif()
+_pgo_train(pgo use _pgo)
+
+math(EXPR _speedup_pct "(${_baseline_median} - ${_pgo_median}) * 100 / ${_baseline_median}")
+message(STATUS "PGO result (median of ${PGO_REPETITIONS}): "
+               "baseline ${_baseline_median} ns [${_baseline_min}..${_baseline_max}], "
+               "PGO ${_pgo_median} ns [${_pgo_min}..${_pgo_max}] - speedup ${_speedup_pct}%")
+if(_pgo_max GREATER_EQUAL _baseline_min AND _baseline_max GREATER_EQUAL _pgo_min)
+    message(STATUS "PGO result: run ranges overlap, the difference is within run-to-run noise")
+endif()
+message(STATUS "Optimized build: ${PGO_BUILD_ROOT}/pgo")
@@ -0,0 +1,273 @@
+#include "AddressResolver.hpp"
+
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+    #pragma comment(lib, "ws2_32.lib")
+#else
+    #include <netdb.h>
+#endif
+
+namespace oc::hal::net {
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Construction / Destruction
+// ═══════════════════════════════════════════════════════════════════════════
+
+AddressResolver::AddressResolver() : AddressResolver(ResolverConfig{}) {}
+
+AddressResolver::AddressResolver(const ResolverConfig& config) : config_(config) {
+    if (!config_.lookup) {
+        config_.lookup = &AddressResolver::systemLookup;
+    }
+}
+
+AddressResolver::~AddressResolver() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+AddressResolver& AddressResolver::shared() {
+    // Intentionally leaked: transports in static objects may outlive it
+    static AddressResolver* resolver = new AddressResolver();
+    return *resolver;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Requests
+// ═══════════════════════════════════════════════════════════════════════════
+
+std::string AddressResolver::cacheKey(const std::string& host, int family) {
+    return std::to_string(family) + '/' + host;
+}
+
+AddressResolver::Ticket AddressResolver::request(const std::string& host, int family,
+                                                 bool bypassCache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Ticket ticket = nextTicket_++;
+
+    if (!bypassCache) {
+        auto it = cache_.find(cacheKey(host, family));
+        if (it != cache_.end() && it->second.expires > Clock::now()) {
+            done_[ticket] = it->second.result;
+            return ticket;
+        }
+    }
+
+    jobs_.push_back(Job{ticket, host, family});
+    pending_.insert(ticket);
+    if (!thread_.joinable()) {
+        thread_ = std::thread(&AddressResolver::run, this);
+    }
+    wake_.notify_one();
+    return ticket;
+}
+
+ResolveStatus AddressResolver::poll(Ticket ticket, ResolveResult& out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = done_.find(ticket);
+    if (it != done_.end()) {
+        out = std::move(it->second);
+        done_.erase(it);
+        return ResolveStatus::Done;
+    }
+    return pending_.count(ticket) ? ResolveStatus::Pending : ResolveStatus::Unknown;
+}
+
+void AddressResolver::cancel(Ticket ticket) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.erase(ticket);
+    done_.erase(ticket);
+}
+
+bool AddressResolver::cached(const std::string& host, int family, ResolveResult& out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = cache_.find(cacheKey(host, family));
+    if (it == cache_.end() || it->second.expires <= Clock::now()) {
+        return false;
+    }
+    out = it->second.result;
+    return true;
+}
+
+void AddressResolver::clearCache() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.clear();
+}
+
+uint64_t AddressResolver::lookups() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lookups_;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Worker Thread
+// ═══════════════════════════════════════════════════════════════════════════
+
+void AddressResolver::run() {
+    (void)applyThreadOptions(config_.thread);
+
+#ifdef _WIN32
+    // getaddrinfo needs Winsock on this thread's process (reference counted)
+    WSADATA wsaData;
+    bool winsock = WSAStartup(MAKEWORD(2, 2), &wsaData) == 0;
+#endif
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+        if (stop_) {
+            break;
+        }
+        Job job = std::move(jobs_.front());
+        jobs_.pop_front();
+        if (!pending_.count(job.ticket)) {
+            continue;  // Cancelled while queued
+        }
+        lookups_++;
+
+        // Blocking lookup without the lock
+        lock.unlock();
+        ResolveResult result;
+        result.error = config_.lookup(job.host, job.family, result.addresses);
+        if (result.error == 0 && result.addresses.empty()) {
+            result.error = EAI_NONAME;
+        }
+        lock.lock();
+
+        store(cacheKey(job.host, job.family), result);
+        if (pending_.erase(job.ticket)) {
+            done_[job.ticket] = std::move(result);
+        }
+    }
+
+#ifdef _WIN32
+    if (winsock) {
+        WSACleanup();
+    }
+#endif
+}
+
+void AddressResolver::store(const std::string& key, const ResolveResult& result) {
+    uint32_t ttlMs = result.ok() ? config_.ttlMs : config_.negativeTtlMs;
+    if (ttlMs == 0 || config_.maxCacheEntries == 0) {
+        cache_.erase(key);
+        return;
+    }
+
+    Clock::time_point now = Clock::now();
+    if (cache_.size() >= config_.maxCacheEntries && cache_.find(key) == cache_.end()) {
+        // Evict the entry closest to expiry (expired ones first)
+        auto victim = cache_.begin();
+        for (auto it = cache_.begin(); it != cache_.end(); ++it) {
+            if (it->second.expires < victim->second.expires) {
+                victim = it;
+            }
+        }
+        cache_.erase(victim);
+    }
+    cache_[key] = CacheEntry{result, now + std::chrono::milliseconds(ttlMs)};
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Lookup Backends
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+int collect(const std::string& host, int family, int flags,
+            std::vector<ResolvedAddress>& out) {
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = family;
+    hints.ai_socktype = SOCK_DGRAM;
+    hints.ai_protocol = IPPROTO_UDP;
+    hints.ai_flags = flags;
+
+    struct addrinfo* results = nullptr;
+    int status = getaddrinfo(host.c_str(), nullptr, &hints, &results);
+    if (status != 0) {
+        return status;
+    }
+    for (struct addrinfo* ai = results; ai != nullptr; ai = ai->ai_next) {
+        if (ai->ai_addrlen > sizeof(sockaddr_storage)) {
+            continue;
+        }
+        ResolvedAddress address;
+        memset(&address.addr, 0, sizeof(address.addr));
+        memcpy(&address.addr, ai->ai_addr, ai->ai_addrlen);
+        address.length = static_cast<socklen_t>(ai->ai_addrlen);
+        out.push_back(address);
+    }
+    freeaddrinfo(results);
+    return 0;
+}
+
+}  // namespace
+
+bool AddressResolver::parseNumeric(const std::string& host, int family, ResolvedAddress& out) {
+    std::vector<ResolvedAddress> addresses;
+    if (collect(host, family, AI_NUMERICHOST, addresses) != 0 || addresses.empty()) {
+        return false;
+    }
+    out = addresses.front();
+    return true;
+}
+
+int AddressResolver::systemLookup(const std::string& host, int family,
+                                  std::vector<ResolvedAddress>& out) {
+    return collect(host, family, 0, out);
+}
+
+LookupFunction AddressResolver::hostsFileLookup(const std::string& path) {
+    // name -> addresses in file order
+    std::unordered_map<std::string, std::vector<std::string>> entries;
+
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+        std::string address;
+        std::string name;
+        if (!(fields >> address)) {
+            continue;
+        }
+        while (fields >> name) {
+            for (char& c : name) {
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            }
+            entries[name].push_back(address);
+        }
+    }
+
+    return [entries = std::move(entries)](const std::string& host, int family,
+                                          std::vector<ResolvedAddress>& out) {
+        std::string name = host;
+        for (char& c : name) {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        auto it = entries.find(name);
+        if (it == entries.end()) {
+            return EAI_NONAME;
+        }
+        for (const std::string& literal : it->second) {
+            ResolvedAddress address;
+            if (parseNumeric(literal, family, address)) {
+                out.push_back(address);
+            }
+        }
+        return out.empty() ? EAI_NONAME : 0;
+    };
+}
+
+}  // namespace oc::hal::net
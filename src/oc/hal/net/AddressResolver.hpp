@@ -0,0 +1,221 @@
+#pragma once
+
+/**
+ * @file AddressResolver.hpp
+ * @brief Background hostname resolution with a TTL cache
+ *
+ * getaddrinfo() can block for seconds on a slow or unreachable DNS
+ * server. AddressResolver runs lookups on one background thread and
+ * hands results back through tickets that the owner polls from its own
+ * update(), so connection setup never stalls the main loop. Results
+ * (including failures, with a shorter TTL) are cached per host/family.
+ *
+ * Numeric hosts ("127.0.0.1", "::1") never need the thread: parseNumeric()
+ * converts them synchronously.
+ *
+ * The lookup function is injectable. hostsFileLookup() resolves from a
+ * hosts(5)-format file only, for tests that must not touch the network.
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * AddressResolver resolver;
+ * auto ticket = resolver.request("bridge.local", AF_UNSPEC);
+ *
+ * // In update()
+ * ResolveResult result;
+ * if (resolver.poll(ticket, result) == ResolveStatus::Done && result.ok()) {
+ *     useAddress(result.addresses.front());
+ * }
+ * ```
+ *
+ * ## Platform Notes
+ *
+ * - Native builds only (needs std::thread and socket headers)
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ThreadOptions.hpp"
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+#endif
+
+namespace oc::hal::net {
+
+/**
+ * @brief One resolved socket address (port 0; callers fill in their port)
+ */
+struct ResolvedAddress {
+    struct sockaddr_storage addr;
+    socklen_t length = 0;
+
+    int family() const { return addr.ss_family; }
+};
+
+/**
+ * @brief Outcome of one lookup
+ */
+struct ResolveResult {
+    /// 0 on success, otherwise the lookup's error code (EAI_* for getaddrinfo)
+    int error = 0;
+
+    /// Addresses in the resolver's preference order
+    std::vector<ResolvedAddress> addresses;
+
+    bool ok() const { return error == 0 && !addresses.empty(); }
+};
+
+enum class ResolveStatus {
+    Pending,  ///< Lookup still queued or running
+    Done,     ///< Result delivered (the ticket is consumed)
+    Unknown   ///< Invalid, cancelled or already consumed ticket
+};
+
+/**
+ * @brief Lookup backend: fill out for host/family (AF_UNSPEC, AF_INET,
+ *        AF_INET6) and return 0, or return an error code
+ *
+ * Runs on the resolver thread; may block.
+ */
+using LookupFunction =
+    std::function<int(const std::string& host, int family, std::vector<ResolvedAddress>& out)>;
+
+/**
+ * @brief Configuration for AddressResolver
+ */
+struct ResolverConfig {
+    /// How long successful results stay cached (ms)
+    uint32_t ttlMs = 60000;
+
+    /// How long failed lookups stay cached (ms, 0 = don't cache failures)
+    uint32_t negativeTtlMs = 5000;
+
+    /// Cache capacity (entries closest to expiry are evicted first)
+    size_t maxCacheEntries = 64;
+
+    /// Lookup backend (empty = getaddrinfo)
+    LookupFunction lookup;
+
+    /// Worker thread placement (applied when the worker starts)
+    ThreadOptions thread{"oc-resolver"};
+};
+
+class AddressResolver {
+public:
+    /// Request handle, 0 = none
+    using Ticket = uint64_t;
+
+    AddressResolver();
+    explicit AddressResolver(const ResolverConfig& config);
+
+    /// Stops the thread; waits for a lookup in progress to return
+    ~AddressResolver();
+
+    // Non-copyable, non-movable (owns a thread bound to this)
+    AddressResolver(const AddressResolver&) = delete;
+    AddressResolver& operator=(const AddressResolver&) = delete;
+
+    /**
+     * @brief Queue a lookup (thread-safe, never blocks on DNS)
+     *
+     * A fresh cache entry completes the ticket immediately; poll() then
+     * returns Done on its first call. The worker thread starts on the
+     * first request that needs it.
+     *
+     * @param bypassCache Ignore (and replace) any cached entry
+     */
+    Ticket request(const std::string& host, int family, bool bypassCache = false);
+
+    /**
+     * @brief Collect the result of a request (thread-safe, non-blocking)
+     */
+    ResolveStatus poll(Ticket ticket, ResolveResult& out);
+
+    /// Forget a request; its result is discarded when the lookup finishes
+    void cancel(Ticket ticket);
+
+    /// Fresh cached result for host/family, false on miss or expiry
+    bool cached(const std::string& host, int family, ResolveResult& out);
+
+    /// Drop all cached results
+    void clearCache();
+
+    /// Lookups actually performed (cache misses)
+    uint64_t lookups() const;
+
+    /**
+     * @brief Convert an IPv4/IPv6 literal without any name service
+     *
+     * @return false if host is not a numeric address of an allowed family
+     */
+    static bool parseNumeric(const std::string& host, int family, ResolvedAddress& out);
+
+    /// getaddrinfo-based backend (the default)
+    static int systemLookup(const std::string& host, int family,
+                            std::vector<ResolvedAddress>& out);
+
+    /**
+     * @brief Backend answering only from a hosts(5)-format file
+     *
+     * The file is read once, here. Unknown names fail with EAI_NONAME.
+     */
+    static LookupFunction hostsFileLookup(const std::string& path);
+
+    /// Process-wide resolver shared by transports without their own (never destroyed)
+    static AddressResolver& shared();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Job {
+        Ticket ticket;
+        std::string host;
+        int family;
+    };
+
+    struct CacheEntry {
+        ResolveResult result;
+        Clock::time_point expires;
+    };
+
+    static std::string cacheKey(const std::string& host, int family);
+
+    void run();
+    void store(const std::string& key, const ResolveResult& result);
+
+    ResolverConfig config_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::thread thread_;
+    bool stop_ = false;
+
+    Ticket nextTicket_ = 1;
+    std::deque<Job> jobs_;
+    std::unordered_set<Ticket> pending_;  ///< Queued or running, not cancelled
+    std::unordered_map<Ticket, ResolveResult> done_;
+    std::unordered_map<std::string, CacheEntry> cache_;
+    uint64_t lookups_ = 0;
+};
+
+}  // namespace oc::hal::net
@@ -0,0 +1,48 @@
+/**
+ * @file CaptureTransport.cpp
+ * @brief Recording transport decorator implementation
+ */
+
+#ifndef __EMSCRIPTEN__
+
+#include "CaptureTransport.hpp"
+
+namespace oc::hal::net {
+
+CaptureTransport::CaptureTransport(interface::ITransport& inner, const CaptureConfig& config)
+    : inner_(inner)
+    , config_(config) {
+    inner_.setOnReceive([this](const uint8_t* data, size_t length) {
+        writer_.record(CaptureDirection::Rx, CaptureWriter::nowNs(), data, length);
+        if (onReceive_) {
+            onReceive_(data, length);
+        }
+    });
+}
+
+CaptureTransport::~CaptureTransport() {
+    inner_.setOnReceive(nullptr);
+}
+
+oc::type::Result<void> CaptureTransport::init() {
+    if (!writer_.isOpen()) {
+        auto result = writer_.open(config_);
+        if (!result.isOk()) {
+            return result;
+        }
+    }
+    return inner_.init();
+}
+
+void CaptureTransport::send(const uint8_t* data, size_t length) {
+    writer_.record(CaptureDirection::Tx, CaptureWriter::nowNs(), data, length);
+    inner_.send(data, length);
+}
+
+void CaptureTransport::setOnReceive(ReceiveCallback cb) {
+    onReceive_ = std::move(cb);
+}
+
+}  // namespace oc::hal::net
+
+#endif  // __EMSCRIPTEN__
@@ -0,0 +1,85 @@
+#pragma once
+
+/**
+ * @file CaptureTransport.hpp
+ * @brief ITransport decorator recording all rx/tx frames to a pcapng file
+ *
+ * Wraps any transport and records every frame it sends or receives with
+ * a nanosecond timestamp. Writing happens on CaptureWriter's background
+ * thread; the decorator itself only adds a memcpy per frame.
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * CaptureConfig capture;
+ * capture.path = "session.pcapng";
+ *
+ * UdpTransport udp(config);
+ * CaptureTransport transport(udp, capture);
+ * transport.init();                 // Opens the file, then inits udp
+ * transport.setOnReceive(handleFrame);
+ *
+ * // Replay later with ReplayTransport, or open in Wireshark
+ * ```
+ *
+ * ## Platform Notes
+ *
+ * - Native builds only (see CaptureWriter)
+ */
+
+#ifndef __EMSCRIPTEN__
+
+#include <cstddef>
+#include <cstdint>
+
+#include <oc/type/Result.hpp>
+#include <oc/interface/ITransport.hpp>
+
+#include "CaptureWriter.hpp"
+
+namespace oc::hal::net {
+
+/**
+ * @brief Recording decorator for any ITransport
+ *
+ * Takes over the inner transport's receive callback for its lifetime and
+ * clears it on destruction; the inner transport must outlive it.
+ */
+class CaptureTransport : public interface::ITransport {
+public:
+    CaptureTransport(interface::ITransport& inner, const CaptureConfig& config);
+    ~CaptureTransport() override;
+
+    // Non-copyable, non-movable (inner callback captures this)
+    CaptureTransport(const CaptureTransport&) = delete;
+    CaptureTransport& operator=(const CaptureTransport&) = delete;
+    CaptureTransport(CaptureTransport&&) = delete;
+    CaptureTransport& operator=(CaptureTransport&&) = delete;
+
+    /**
+     * @brief Open the capture file and initialize the inner transport
+     *
+     * @return err() if the file cannot be created, else the inner result
+     */
+    oc::type::Result<void> init() override;
+
+    void update() override { inner_.update(); }
+    void send(const uint8_t* data, size_t length) override;
+    void setOnReceive(ReceiveCallback cb) override;
+    bool isReady() const override { return inner_.isReady(); }
+
+    /// Flush and close the capture file (also done on destruction)
+    void stopCapture() { writer_.close(); }
+
+    const CaptureWriter& writer() const { return writer_; }
+
+private:
+    interface::ITransport& inner_;
+    CaptureConfig config_;
+    CaptureWriter writer_;
+    ReceiveCallback onReceive_;
+};
+
+}  // namespace oc::hal::net
+
+#endif  // __EMSCRIPTEN__
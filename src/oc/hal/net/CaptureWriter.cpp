@@ -0,0 +1,143 @@
+/**
+ * @file CaptureWriter.cpp
+ * @brief Asynchronous pcapng writer implementation
+ */
+
+#ifndef __EMSCRIPTEN__
+
+#include "CaptureWriter.hpp"
+
+#include <chrono>
+
+#include <oc/log/Log.hpp>
+
+#include "PcapNg.hpp"
+
+namespace oc::hal::net {
+
+CaptureWriter::~CaptureWriter() {
+    close();
+}
+
+oc::type::Result<void> CaptureWriter::open(const CaptureConfig& config) {
+    if (isOpen()) {
+        return oc::type::Result<void>::err(oc::type::ErrorCode::INVALID_STATE);
+    }
+
+    config_ = config;
+    file_ = std::fopen(config_.path.c_str(), "wb");
+    if (!file_) {
+        OC_LOG_ERROR("[Capture] Cannot create {}", config_.path.c_str());
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+
+    std::vector<uint8_t> header;
+    pcapng::appendFileHeader(header);
+    if (std::fwrite(header.data(), 1, header.size(), file_) != header.size()) {
+        OC_LOG_ERROR("[Capture] Cannot write header to {}", config_.path.c_str());
+        std::fclose(file_);
+        file_ = nullptr;
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+
+    stop_ = false;
+    pending_.reserve(64 * 1024);
+    thread_ = std::thread(&CaptureWriter::run, this);
+    open_.store(true, std::memory_order_release);
+
+    OC_LOG_INFO("[Capture] Recording to {}", config_.path.c_str());
+    return oc::type::Result<void>::ok();
+}
+
+void CaptureWriter::record(CaptureDirection direction, uint64_t timestampNs,
+                           const uint8_t* data, size_t length) {
+    if (!open_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    uint32_t flags = direction == CaptureDirection::Rx ? pcapng::kFlagInbound
+                                                       : pcapng::kFlagOutbound;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stop_) {
+        return;  // close() raced us; the writer thread may already be gone
+    }
+    if (pending_.size() + pcapng::kEpbOverhead + length > config_.maxPendingBytes) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    pcapng::appendPacket(pending_, timestampNs, flags, data, length);
+    pendingRecords_++;
+}
+
+void CaptureWriter::close() {
+    if (!open_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_one();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    std::fclose(file_);
+    file_ = nullptr;
+    OC_LOG_INFO("[Capture] Closed {} ({} records, {} dropped)", config_.path.c_str(),
+                recordsWritten(), recordsDropped());
+}
+
+uint64_t CaptureWriter::nowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+void CaptureWriter::run() {
+    (void)applyThreadOptions(config_.thread);
+
+    std::vector<uint8_t> batch;
+    batch.reserve(pending_.capacity());
+    bool writeFailed = false;
+
+    for (;;) {
+        uint64_t records = 0;
+        bool stopping;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait_for(lock, std::chrono::milliseconds(config_.flushIntervalMs),
+                           [this] { return stop_; });
+            // Swap so record() keeps appending while we write
+            batch.swap(pending_);
+            records = pendingRecords_;
+            pendingRecords_ = 0;
+            stopping = stop_;
+        }
+
+        if (!batch.empty()) {
+            bool ok = std::fwrite(batch.data(), 1, batch.size(), file_) == batch.size();
+            ok = std::fflush(file_) == 0 && ok;
+            if (ok) {
+                written_.fetch_add(records, std::memory_order_relaxed);
+            } else {
+                dropped_.fetch_add(records, std::memory_order_relaxed);
+                if (!writeFailed) {
+                    OC_LOG_WARN("[Capture] Write to {} failed, dropping records",
+                                config_.path.c_str());
+                }
+            }
+            writeFailed = !ok;
+            batch.clear();
+        }
+
+        if (stopping) {
+            return;
+        }
+    }
+}
+
+}  // namespace oc::hal::net
+
+#endif  // __EMSCRIPTEN__
@@ -0,0 +1,121 @@
+#pragma once
+
+/**
+ * @file CaptureWriter.hpp
+ * @brief Buffered, asynchronous pcapng writer for transport frames
+ *
+ * record() copies the frame into an in-memory buffer under a short lock;
+ * a background thread swaps that buffer out and writes it to disk, so
+ * file I/O never happens on the transport's hot path. If the disk falls
+ * behind by more than maxPendingBytes, new records are dropped (and
+ * counted) instead of growing memory without bound. Batches the disk
+ * rejects (e.g. full) are counted as dropped too.
+ *
+ * ## Platform Notes
+ *
+ * - Native builds only (needs std::thread and stdio files)
+ */
+
+#ifndef __EMSCRIPTEN__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <oc/type/Result.hpp>
+
+#include "ThreadOptions.hpp"
+
+namespace oc::hal::net {
+
+/// Direction of a captured frame, relative to the local application
+enum class CaptureDirection : uint8_t {
+    Rx,  ///< Received from the peer
+    Tx   ///< Sent to the peer
+};
+
+/**
+ * @brief Configuration for CaptureWriter
+ */
+struct CaptureConfig {
+    /// Output file (pcapng)
+    std::string path = "capture.pcapng";
+
+    /// Maximum bytes buffered in memory waiting for the writer thread
+    size_t maxPendingBytes = 16 * 1024 * 1024;
+
+    /// Writer thread flush interval (ms)
+    uint32_t flushIntervalMs = 100;
+
+    /// Writer thread placement; e.g. keep it off the receive thread's core
+    ThreadOptions thread{"oc-capture"};
+};
+
+class CaptureWriter {
+public:
+    CaptureWriter() = default;
+    ~CaptureWriter();
+
+    // Non-copyable, non-movable (owns a thread bound to this)
+    CaptureWriter(const CaptureWriter&) = delete;
+    CaptureWriter& operator=(const CaptureWriter&) = delete;
+    CaptureWriter(CaptureWriter&&) = delete;
+    CaptureWriter& operator=(CaptureWriter&&) = delete;
+
+    /**
+     * @brief Create the file, write the pcapng header and start the writer thread
+     */
+    oc::type::Result<void> open(const CaptureConfig& config);
+
+    /**
+     * @brief Append one frame (thread-safe, never blocks on I/O)
+     *
+     * @param direction Rx or Tx
+     * @param timestampNs Nanoseconds since the Unix epoch
+     */
+    void record(CaptureDirection direction, uint64_t timestampNs,
+                const uint8_t* data, size_t length);
+
+    /**
+     * @brief Flush everything buffered, stop the thread and close the file
+     */
+    void close();
+
+    bool isOpen() const { return open_.load(std::memory_order_acquire); }
+
+    /// Records written to disk
+    uint64_t recordsWritten() const { return written_.load(std::memory_order_relaxed); }
+
+    /// Records dropped because maxPendingBytes was exceeded or the write failed
+    uint64_t recordsDropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    /// Current time in ns since the Unix epoch (capture clock)
+    static uint64_t nowNs();
+
+private:
+    void run();
+
+    CaptureConfig config_;
+    std::FILE* file_ = nullptr;  ///< Owned by open()/close() and the writer thread
+    std::atomic<bool> open_{false};  ///< record() fast-path check, never touches file_
+    std::thread thread_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::vector<uint8_t> pending_;
+    uint64_t pendingRecords_ = 0;
+    bool stop_ = false;
+
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+}  // namespace oc::hal::net
+
+#endif  // __EMSCRIPTEN__
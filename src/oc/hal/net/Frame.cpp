@@ -0,0 +1,145 @@
+#include "Frame.hpp"
+
+#include <cstring>
+#include <new>
+
+namespace oc::hal::net {
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FramePool
+// ═══════════════════════════════════════════════════════════════════════════
+
+FramePool::FramePool(size_t maxCachedPerClass, std::pmr::memory_resource* upstream)
+    : maxCachedPerClass_(maxCachedPerClass)
+    , upstream_(upstream ? upstream : std::pmr::get_default_resource()) {}
+
+FramePool::~FramePool() {
+    for (size_t index = 0; index < kClassCount; ++index) {
+        while (FreeBlock* block = free_[index].head) {
+            free_[index].head = block->next;
+            deallocateBlock(reinterpret_cast<uint8_t*>(block), kMinBlockSize << index);
+        }
+    }
+}
+
+size_t FramePool::classIndex(size_t length) {
+    size_t index = 0;
+    size_t blockSize = kMinBlockSize;
+    while (blockSize < length) {
+        blockSize <<= 1;
+        index++;
+    }
+    return index;
+}
+
+uint8_t* FramePool::allocateBlock(size_t capacity) {
+    return static_cast<uint8_t*>(upstream_->allocate(capacity, alignof(std::max_align_t)));
+}
+
+void FramePool::deallocateBlock(uint8_t* block, size_t capacity) {
+    upstream_->deallocate(block, capacity, alignof(std::max_align_t));
+}
+
+uint8_t* FramePool::acquire(size_t length, size_t& capacity) {
+    if (length > kMaxBlockSize) {
+        capacity = length;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            upstreamAllocations_++;
+        }
+        return allocateBlock(capacity);
+    }
+
+    size_t index = classIndex(length);
+    capacity = kMinBlockSize << index;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        FreeList& list = free_[index];
+        if (FreeBlock* block = list.head) {
+            list.head = block->next;
+            list.count--;
+            return reinterpret_cast<uint8_t*>(block);
+        }
+        upstreamAllocations_++;
+    }
+    return allocateBlock(capacity);
+}
+
+void FramePool::release(uint8_t* block, size_t capacity) {
+    if (capacity <= kMaxBlockSize) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        FreeList& list = free_[classIndex(capacity)];
+        if (list.count < maxCachedPerClass_) {
+            list.head = new (block) FreeBlock{list.head};
+            list.count++;
+            return;
+        }
+    }
+    deallocateBlock(block, capacity);
+}
+
+uint64_t FramePool::upstreamAllocations() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return upstreamAllocations_;
+}
+
+FramePool& FramePool::defaultPool() {
+    // Intentionally leaked: frames in other static objects may outlive it
+    static FramePool* pool = new FramePool();
+    return *pool;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Frame
+// ═══════════════════════════════════════════════════════════════════════════
+
+Frame::Frame(const uint8_t* data, size_t length, FramePool& pool) : pool_(&pool) {
+    assign(data, length);
+}
+
+void Frame::assign(const uint8_t* data, size_t length) {
+    uint8_t* payload = prepare(length);
+    if (length > 0) {
+        memcpy(payload, data, length);
+    }
+}
+
+uint8_t* Frame::prepare(size_t length) {
+    if (length > kInlineCapacity && length > capacity_) {
+        releaseBlock();
+        if (!pool_) {
+            pool_ = &FramePool::defaultPool();
+        }
+        block_ = pool_->acquire(length, capacity_);
+    } else if (length <= kInlineCapacity && block_) {
+        releaseBlock();
+    }
+    size_ = length;
+    return data();
+}
+
+void Frame::releaseBlock() {
+    if (block_) {
+        pool_->release(block_, capacity_);
+        block_ = nullptr;
+        capacity_ = 0;
+    }
+}
+
+void Frame::moveFrom(Frame& other) {
+    pool_ = other.pool_;
+    size_ = other.size_;
+    if (other.block_) {
+        block_ = other.block_;
+        capacity_ = other.capacity_;
+        other.block_ = nullptr;
+        other.capacity_ = 0;
+    } else {
+        block_ = nullptr;
+        capacity_ = 0;
+        memcpy(inline_, other.inline_, size_);
+    }
+    other.size_ = 0;
+}
+
+}  // namespace oc::hal::net
@@ -0,0 +1,175 @@
+#pragma once
+
+/**
+ * @file Frame.hpp
+ * @brief Move-only owned frame with inline small-buffer storage
+ *
+ * Queuing a frame as std::vector<uint8_t> costs one heap allocation per
+ * message, even for the typical 10-40 byte control frames. Frame stores
+ * up to kInlineCapacity bytes inline and takes larger payloads from a
+ * FramePool, which recycles blocks by power-of-two size class. Moving a
+ * Frame never allocates.
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * std::deque<Frame> queue;
+ * transport.setOnReceive([&](const uint8_t* data, size_t len) {
+ *     queue.emplace_back(data, len);   // No allocation for len <= 64
+ * });
+ *
+ * while (!queue.empty()) {
+ *     Frame& f = queue.front();
+ *     handle(f.data(), f.size());
+ *     queue.pop_front();               // Large blocks go back to the pool
+ * }
+ * ```
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+
+namespace oc::hal::net {
+
+/**
+ * @brief Size-class free lists backing Frame payloads above the inline limit
+ *
+ * Blocks are powers of two from kMinBlockSize to kMaxBlockSize; larger
+ * requests bypass the pool. Each class keeps at most maxCachedPerClass
+ * free blocks. Thread-safe (one mutex, held only for a list push/pop), so
+ * frames may be released on a different thread than the one that filled
+ * them. The pool must outlive every Frame that uses it.
+ *
+ * Blocks come from the upstream memory_resource (e.g. a preallocated
+ * arena); free lists are threaded through the cached blocks themselves,
+ * so the pool does no bookkeeping allocations.
+ */
+class FramePool {
+public:
+    static constexpr size_t kMinBlockSize = 128;
+    static constexpr size_t kMaxBlockSize = 64 * 1024;
+    static constexpr size_t kClassCount = 10;  // 128 .. 64K
+
+    /**
+     * @param maxCachedPerClass Free blocks kept per size class
+     * @param upstream Block allocator (nullptr = std::pmr::get_default_resource())
+     */
+    explicit FramePool(size_t maxCachedPerClass = 64,
+                       std::pmr::memory_resource* upstream = nullptr);
+    ~FramePool();
+
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    /**
+     * @brief Get a block of at least length bytes
+     *
+     * @param capacity Receives the block's usable size (pass it back to release())
+     */
+    uint8_t* acquire(size_t length, size_t& capacity);
+
+    /// Return a block obtained from acquire()
+    void release(uint8_t* block, size_t capacity);
+
+    /// Blocks obtained from the upstream resource (cache misses + oversize)
+    uint64_t upstreamAllocations() const;
+
+    /// Process-wide pool used by Frame when none is given (never destroyed)
+    static FramePool& defaultPool();
+
+private:
+    static size_t classIndex(size_t length);
+
+    uint8_t* allocateBlock(size_t capacity);
+    void deallocateBlock(uint8_t* block, size_t capacity);
+
+    const size_t maxCachedPerClass_;
+    std::pmr::memory_resource* upstream_;
+    mutable std::mutex mutex_;
+    /// Header written into a cached block
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct FreeList {
+        FreeBlock* head = nullptr;
+        size_t count = 0;
+    };
+
+    std::array<FreeList, kClassCount> free_;
+    uint64_t upstreamAllocations_ = 0;
+};
+
+/**
+ * @brief Owned, move-only frame payload
+ *
+ * Frames of up to kInlineCapacity bytes live inside the object; larger
+ * ones hold a FramePool block that is returned on destruction.
+ */
+class Frame {
+public:
+    static constexpr size_t kInlineCapacity = 64;
+
+    Frame() = default;
+
+    /// Copy length bytes from data (pool-backed above kInlineCapacity)
+    Frame(const uint8_t* data, size_t length) : Frame(data, length, FramePool::defaultPool()) {}
+    Frame(const uint8_t* data, size_t length, FramePool& pool);
+
+    ~Frame() { releaseBlock(); }
+
+    Frame(Frame&& other) noexcept { moveFrom(other); }
+
+    Frame& operator=(Frame&& other) noexcept {
+        if (this != &other) {
+            releaseBlock();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    Frame(const Frame&) = delete;
+    Frame& operator=(const Frame&) = delete;
+
+    /**
+     * @brief Replace the contents, reusing the current block when it fits
+     */
+    void assign(const uint8_t* data, size_t length);
+
+    /**
+     * @brief Resize to length bytes without copying and return the payload
+     *
+     * Contents are unspecified; the caller fills them in (e.g. a header
+     * followed by a payload, without an intermediate buffer).
+     */
+    uint8_t* prepare(size_t length);
+
+    /// Release storage and become empty (the pool binding is kept)
+    void clear() {
+        releaseBlock();
+        size_ = 0;
+    }
+
+    const uint8_t* data() const { return block_ ? block_ : inline_; }
+    uint8_t* data() { return block_ ? block_ : inline_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    /// True if the payload is stored inside the object
+    bool isInline() const { return block_ == nullptr; }
+
+private:
+    void releaseBlock();
+    void moveFrom(Frame& other);
+
+    uint8_t* block_ = nullptr;
+    FramePool* pool_ = nullptr;
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+    alignas(8) uint8_t inline_[kInlineCapacity];
+};
+
+}  // namespace oc::hal::net
@@ -0,0 +1,120 @@
+#pragma once
+
+/**
+ * @file FrameRing.hpp
+ * @brief Preallocated single-producer/single-consumer ring of frames
+ *
+ * Fixed number of fixed-size slots in one contiguous allocation made at
+ * construction; push/pop never allocate or make syscalls. One thread may
+ * push while another pops (acquire/release on the indices), or both may
+ * run on the same thread.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <vector>
+
+namespace oc::hal::net {
+
+class FrameRing {
+public:
+    /**
+     * @param capacity Number of frames (rounded up to a power of two)
+     * @param maxFrameSize Largest frame a slot can hold
+     * @param resource Allocator for the slots (nullptr = std::pmr::get_default_resource())
+     */
+    FrameRing(size_t capacity, size_t maxFrameSize,
+              std::pmr::memory_resource* resource = nullptr)
+        : mask_(roundUpPow2(capacity) - 1)
+        , slotSize_(maxFrameSize)
+        , lengths_(mask_ + 1, orDefault(resource))
+        , storage_((mask_ + 1) * maxFrameSize, orDefault(resource)) {}
+
+    // Non-copyable, non-movable (indices shared between threads)
+    FrameRing(const FrameRing&) = delete;
+    FrameRing& operator=(const FrameRing&) = delete;
+
+    /**
+     * @brief Copy a frame into the next free slot (producer side)
+     *
+     * @return false if the ring is full or the frame exceeds maxFrameSize
+     */
+    bool tryPush(const uint8_t* data, size_t length) {
+        if (length > slotSize_) {
+            return false;
+        }
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - headCache_ > mask_) {
+            headCache_ = head_.load(std::memory_order_acquire);
+            if (tail - headCache_ > mask_) {
+                return false;
+            }
+        }
+        const size_t slot = tail & mask_;
+        memcpy(&storage_[slot * slotSize_], data, length);
+        lengths_[slot] = static_cast<uint32_t>(length);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Hand queued frames to fn(data, length), oldest first (consumer side)
+     *
+     * Slots are released together once the batch is done, so fn may read
+     * the data in place. Stops after maxFrames (0 = everything queued on entry).
+     *
+     * @return Number of frames consumed
+     */
+    template <typename Fn>
+    size_t drain(Fn&& fn, size_t maxFrames = 0) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        const size_t tail = tail_.load(std::memory_order_acquire);
+        size_t count = tail - head;
+        if (maxFrames > 0 && count > maxFrames) {
+            count = maxFrames;
+        }
+        for (size_t i = 0; i < count; ++i, ++head) {
+            const size_t slot = head & mask_;
+            fn(static_cast<const uint8_t*>(&storage_[slot * slotSize_]),
+               static_cast<size_t>(lengths_[slot]));
+        }
+        if (count > 0) {
+            head_.store(head, std::memory_order_release);
+        }
+        return count;
+    }
+
+    /// Frames currently queued (approximate while the other side is active)
+    size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+    size_t maxFrameSize() const { return slotSize_; }
+
+private:
+    static std::pmr::memory_resource* orDefault(std::pmr::memory_resource* resource) {
+        return resource ? resource : std::pmr::get_default_resource();
+    }
+
+    static size_t roundUpPow2(size_t n) {
+        size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    const size_t mask_;
+    const size_t slotSize_;
+    std::pmr::vector<uint32_t> lengths_;
+    std::pmr::vector<uint8_t> storage_;
+
+    // Producer and consumer indices on separate cache lines
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+    size_t headCache_ = 0;  ///< Producer's last view of head_
+};
+
+}  // namespace oc::hal::net
@@ -0,0 +1,184 @@
+#include "ImpairedTransport.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace oc::hal::net {
+
+namespace {
+
+/// Heap order: earliest release first, FIFO among equal release times
+bool laterThan(uint64_t releaseA, uint64_t seqA, uint64_t releaseB, uint64_t seqB) {
+    return releaseA != releaseB ? releaseA > releaseB : seqA > seqB;
+}
+
+}  // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Random
+// ═══════════════════════════════════════════════════════════════════════════
+
+uint64_t ImpairedTransport::Random::next() {
+    uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+double ImpairedTransport::Random::uniform() {
+    // 53 random bits -> [0, 1)
+    return static_cast<double>(next() >> 11) * 0x1.0p-53;
+}
+
+double ImpairedTransport::Random::normal() {
+    double u1 = uniform();
+    double u2 = uniform();
+    if (u1 < 1e-300) u1 = 1e-300;
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ImpairedTransport
+// ═══════════════════════════════════════════════════════════════════════════
+
+ImpairedTransport::ImpairedTransport(interface::ITransport& inner,
+                                     const ImpairmentConfig& config)
+    : inner_(inner)
+    , clock_(config.clock)
+    , tx_(config.tx, config.seed)
+    , rx_(config.rx, config.seed ^ 0xA5A5A5A5A5A5A5A5ULL) {
+    inner_.setOnReceive([this](const uint8_t* data, size_t length) {
+        enqueue(rx_, data, length);
+    });
+}
+
+ImpairedTransport::~ImpairedTransport() {
+    inner_.setOnReceive(nullptr);
+}
+
+void ImpairedTransport::update() {
+    inner_.update();
+
+    release(tx_, [this](const uint8_t* data, size_t length) {
+        inner_.send(data, length);
+    });
+    release(rx_, [this](const uint8_t* data, size_t length) {
+        if (onReceive_) {
+            onReceive_(data, length);
+        }
+    });
+}
+
+void ImpairedTransport::send(const uint8_t* data, size_t length) {
+    enqueue(tx_, data, length);
+}
+
+void ImpairedTransport::setOnReceive(ReceiveCallback cb) {
+    onReceive_ = std::move(cb);
+}
+
+uint64_t ImpairedTransport::nextReleaseInUs() const {
+    uint64_t next = std::numeric_limits<uint64_t>::max();
+    if (!tx_.heap.empty()) next = std::min(next, tx_.heap.front().releaseUs);
+    if (!rx_.heap.empty()) next = std::min(next, rx_.heap.front().releaseUs);
+    if (next == std::numeric_limits<uint64_t>::max()) {
+        return next;
+    }
+    uint64_t t = now();
+    return next > t ? next - t : 0;
+}
+
+uint64_t ImpairedTransport::now() const {
+    if (clock_) {
+        return clock_();
+    }
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void ImpairedTransport::enqueue(Direction& dir, const uint8_t* data, size_t length) {
+    const ImpairmentProfile& p = dir.profile;
+
+    // Loss: Gilbert-Elliott state transition, then the state's loss rate
+    if (p.burstEnterRate > 0.0) {
+        double r = dir.random.uniform();
+        dir.burstBad = dir.burstBad ? (r >= p.burstExitRate) : (r < p.burstEnterRate);
+        if (dir.burstBad && dir.random.uniform() < p.burstLossRate) {
+            dir.stats.lost++;
+            return;
+        }
+    }
+    if (p.lossRate > 0.0 && dir.random.uniform() < p.lossRate) {
+        dir.stats.lost++;
+        return;
+    }
+
+    if (p.queueLimit > 0 && dir.heap.size() >= p.queueLimit) {
+        dir.stats.queueDrops++;
+        return;
+    }
+
+    // Bandwidth: frames serialize one after another on the simulated link
+    uint64_t t = now();
+    uint64_t departUs = t;
+    if (p.rateLimitBytesPerSec > 0) {
+        // ns with the division remainder carried over, so small frames at
+        // high rates still cost their share instead of truncating to 0 µs
+        uint64_t scaled = length * 1000000000ULL + dir.linkCarry;
+        dir.linkCarry = scaled % p.rateLimitBytesPerSec;
+        dir.linkFreeNs = std::max(dir.linkFreeNs, t * 1000) + scaled / p.rateLimitBytesPerSec;
+        departUs = (dir.linkFreeNs + 999) / 1000;
+    }
+
+    // Delay: fixed + jitter (+ reorder hold-back)
+    double delay = p.latencyUs;
+    if (p.jitterUs > 0) {
+        double j = p.jitter == JitterDistribution::Normal
+                       ? dir.random.normal()
+                       : dir.random.uniform() * 2.0 - 1.0;
+        delay += j * p.jitterUs;
+    }
+    if (p.reorderRate > 0.0 && dir.random.uniform() < p.reorderRate) {
+        delay += p.reorderDelayUs;
+        dir.stats.reordered++;
+    }
+    uint64_t releaseUs = departUs + static_cast<uint64_t>(std::max(0.0, delay));
+
+    push(dir, releaseUs, data, length);
+
+    if (p.duplicateRate > 0.0 && dir.random.uniform() < p.duplicateRate) {
+        push(dir, releaseUs, data, length);
+        dir.stats.duplicated++;
+    }
+}
+
+void ImpairedTransport::push(Direction& dir, uint64_t releaseUs,
+                             const uint8_t* data, size_t length) {
+    dir.heap.push_back(InFlight{releaseUs, dir.nextSeq++,
+                                Frame(data, length)});
+    std::push_heap(dir.heap.begin(), dir.heap.end(), [](const InFlight& a, const InFlight& b) {
+        return laterThan(a.releaseUs, a.seq, b.releaseUs, b.seq);
+    });
+    dir.stats.queued = dir.heap.size();
+}
+
+template <typename Deliver>
+void ImpairedTransport::release(Direction& dir, Deliver&& deliver) {
+    const uint64_t t = now();
+    auto order = [](const InFlight& a, const InFlight& b) {
+        return laterThan(a.releaseUs, a.seq, b.releaseUs, b.seq);
+    };
+
+    while (!dir.heap.empty() && dir.heap.front().releaseUs <= t) {
+        std::pop_heap(dir.heap.begin(), dir.heap.end(), order);
+        InFlight frame = std::move(dir.heap.back());
+        dir.heap.pop_back();
+        dir.stats.queued = dir.heap.size();
+        dir.stats.delivered++;
+        deliver(frame.data.data(), frame.data.size());
+    }
+}
+
+}  // namespace oc::hal::net
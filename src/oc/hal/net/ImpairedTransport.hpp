@@ -0,0 +1,206 @@
+#pragma once
+
+/**
+ * @file ImpairedTransport.hpp
+ * @brief ITransport decorator simulating latency, jitter, loss, duplication,
+ *        reordering and bandwidth limits
+ *
+ * Wraps any transport (typically a LoopbackTransportPair endpoint, or
+ * UdpTransport on loopback) and applies a seeded, reproducible impairment
+ * profile to each direction, netem-style but in process. Time comes from
+ * an injectable microsecond clock, so a test can step a virtual clock and
+ * get bit-identical results on every run.
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * uint64_t simTimeUs = 0;
+ *
+ * ImpairmentConfig impair;
+ * impair.seed = 42;
+ * impair.clock = [&] { return simTimeUs; };
+ * impair.tx.latencyUs = 20000;          // 20 ms one way
+ * impair.tx.jitterUs = 5000;
+ * impair.tx.lossRate = 0.01;
+ * impair.tx.rateLimitBytesPerSec = 1000000;
+ *
+ * ImpairedTransport transport(udp, impair);
+ * transport.init();
+ *
+ * // In the test loop
+ * simTimeUs += 1000;
+ * transport.update();                   // Releases frames that are due
+ * ```
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <oc/type/Result.hpp>
+#include <oc/interface/ITransport.hpp>
+
+#include "Frame.hpp"
+
+namespace oc::hal::net {
+
+/// Shape of the random part of the delay
+enum class JitterDistribution {
+    Uniform,  ///< Uniform in [-jitterUs, +jitterUs]
+    Normal    ///< Gaussian with standard deviation jitterUs (clamped at 0 total delay)
+};
+
+/**
+ * @brief Impairments applied to one direction
+ *
+ * All defaults are "no impairment".
+ */
+struct ImpairmentProfile {
+    /// Fixed one-way delay (us)
+    uint32_t latencyUs = 0;
+
+    /// Random delay added on top of latencyUs (us); reorders frames like netem
+    uint32_t jitterUs = 0;
+    JitterDistribution jitter = JitterDistribution::Uniform;
+
+    /// Independent (Bernoulli) loss probability per frame
+    double lossRate = 0.0;
+
+    /// Gilbert-Elliott burst loss: per-frame probability of entering /
+    /// leaving the "bad" state, and loss probability while in it
+    double burstEnterRate = 0.0;
+    double burstExitRate = 0.25;
+    double burstLossRate = 1.0;
+
+    /// Probability that a frame is delivered twice
+    double duplicateRate = 0.0;
+
+    /// Probability that a frame is held back by reorderDelayUs extra
+    double reorderRate = 0.0;
+    uint32_t reorderDelayUs = 1000;
+
+    /// Link bandwidth (bytes/s, 0 = unlimited); frames queue behind each other
+    uint64_t rateLimitBytesPerSec = 0;
+
+    /// Maximum frames waiting in the simulated link (0 = unlimited), tail drop
+    size_t queueLimit = 0;
+};
+
+/**
+ * @brief Configuration for ImpairedTransport
+ */
+struct ImpairmentConfig {
+    /// Applied to frames passed to send()
+    ImpairmentProfile tx;
+
+    /// Applied to frames received from the inner transport
+    ImpairmentProfile rx;
+
+    /// PRNG seed; identical seed + clock + traffic = identical outcome
+    uint64_t seed = 1;
+
+    /// Microsecond clock (default: steady_clock)
+    std::function<uint64_t()> clock;
+};
+
+/**
+ * @brief Per-direction impairment counters
+ */
+struct ImpairmentStats {
+    uint64_t delivered = 0;   ///< Frames released (including duplicates)
+    uint64_t lost = 0;        ///< Random + burst losses
+    uint64_t queueDrops = 0;  ///< Tail drops at queueLimit
+    uint64_t duplicated = 0;
+    uint64_t reordered = 0;
+    size_t queued = 0;        ///< Frames currently in flight
+};
+
+/**
+ * @brief Deterministic network impairment decorator
+ *
+ * Received frames reach the delay queues through a callback installed on
+ * the inner transport; the destructor removes it, so the inner transport
+ * only has to outlive this object. Frames still queued at that point are
+ * discarded.
+ */
+class ImpairedTransport : public interface::ITransport {
+public:
+    ImpairedTransport(interface::ITransport& inner, const ImpairmentConfig& config);
+    ~ImpairedTransport() override;
+
+    // Non-copyable, non-movable (inner callback captures this)
+    ImpairedTransport(const ImpairedTransport&) = delete;
+    ImpairedTransport& operator=(const ImpairedTransport&) = delete;
+    ImpairedTransport(ImpairedTransport&&) = delete;
+    ImpairedTransport& operator=(ImpairedTransport&&) = delete;
+
+    oc::type::Result<void> init() override { return inner_.init(); }
+
+    /**
+     * @brief Update the inner transport, then release every frame that is due
+     */
+    void update() override;
+
+    /**
+     * @brief Queue a frame through the tx impairment profile
+     */
+    void send(const uint8_t* data, size_t length) override;
+
+    void setOnReceive(ReceiveCallback cb) override;
+    bool isReady() const override { return inner_.isReady(); }
+
+    const ImpairmentStats& txStats() const { return tx_.stats; }
+    const ImpairmentStats& rxStats() const { return rx_.stats; }
+
+    /// Microseconds until the next queued frame is due (UINT64_MAX if none)
+    uint64_t nextReleaseInUs() const;
+
+private:
+    /// Small, fast, seedable PRNG (splitmix64) - same sequence everywhere
+    class Random {
+    public:
+        explicit Random(uint64_t seed) : state_(seed) {}
+        uint64_t next();
+        double uniform();  ///< [0, 1)
+        double normal();   ///< Standard normal (Box-Muller)
+
+    private:
+        uint64_t state_;
+    };
+
+    struct InFlight {
+        uint64_t releaseUs;
+        uint64_t seq;
+        Frame data;
+    };
+
+    struct Direction {
+        Direction(const ImpairmentProfile& p, uint64_t seed) : profile(p), random(seed) {}
+
+        ImpairmentProfile profile;
+        Random random;
+        bool burstBad = false;
+        uint64_t linkFreeNs = 0;    ///< When the simulated link finishes its backlog
+        uint64_t linkCarry = 0;     ///< Serialization remainder (ns * bytes/s)
+        uint64_t nextSeq = 0;
+        std::vector<InFlight> heap;  ///< Min-heap on (releaseUs, seq)
+        ImpairmentStats stats;
+    };
+
+    void enqueue(Direction& dir, const uint8_t* data, size_t length);
+    void push(Direction& dir, uint64_t releaseUs, const uint8_t* data, size_t length);
+    uint64_t now() const;
+
+    template <typename Deliver>
+    void release(Direction& dir, Deliver&& deliver);
+
+    interface::ITransport& inner_;
+    std::function<uint64_t()> clock_;
+    ReceiveCallback onReceive_;
+
+    Direction tx_;
+    Direction rx_;
+};
+
+}  // namespace oc::hal::net
@@ -0,0 +1,121 @@
+#include "LatencyHistogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+namespace oc::hal::net {
+
+namespace {
+
+unsigned highestBit(uint64_t value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#endif
+}
+
+}  // namespace
+
+size_t LatencyHistogram::bucketIndex(uint64_t ns) {
+    if (ns < kSubBucketCount) {
+        return static_cast<size_t>(ns);
+    }
+
+    // Keep the top kSubBucketBits bits: (ns >> shift) is in [half, count)
+    unsigned shift = highestBit(ns) - kSubBucketBits + 1;
+    size_t mantissa = static_cast<size_t>(ns >> shift) - kSubBucketHalf;
+    return kSubBucketCount + (shift - 1) * kSubBucketHalf + mantissa;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t index) {
+    if (index < kSubBucketCount) {
+        return index;
+    }
+
+    size_t k = index - kSubBucketCount;
+    unsigned shift = static_cast<unsigned>(k / kSubBucketHalf) + 1;
+    uint64_t mantissa = k % kSubBucketHalf + kSubBucketHalf;
+    // Wraps to UINT64_MAX for the very last bucket
+    return ((mantissa + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t ns) {
+    buckets_[bucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(ns, std::memory_order_relaxed);
+
+    uint64_t current = max_.load(std::memory_order_relaxed);
+    while (ns > current &&
+           !max_.compare_exchange_weak(current, ns, std::memory_order_relaxed)) {
+    }
+
+    current = min_.load(std::memory_order_relaxed);
+    while (ns < current &&
+           !min_.compare_exchange_weak(current, ns, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t LatencyHistogram::percentile(double q) const {
+    uint64_t total = count();
+    if (total == 0) {
+        return 0;
+    }
+
+    q = std::clamp(q, 0.0, 1.0);
+    uint64_t target = static_cast<uint64_t>(std::ceil(q * static_cast<double>(total)));
+    target = std::max<uint64_t>(target, 1);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            // Bucket bounds are coarser than the exact extremes. A concurrent
+            // record() bumps count_ before min_/max_, so lo > hi is possible.
+            uint64_t bound = bucketUpperBound(i);
+            uint64_t lo = min_.load(std::memory_order_relaxed);
+            uint64_t hi = max();
+            if (lo > hi) {
+                return bound;
+            }
+            return std::clamp(bound, lo, hi);
+        }
+    }
+    return max();
+}
+
+LatencySummary LatencyHistogram::summary() const {
+    LatencySummary s;
+    s.count = count();
+    if (s.count == 0) {
+        return s;
+    }
+
+    s.minNs = min_.load(std::memory_order_relaxed);
+    s.maxNs = max();
+    s.meanNs = sum_.load(std::memory_order_relaxed) / s.count;
+    s.p50Ns = percentile(0.50);
+    s.p90Ns = percentile(0.90);
+    s.p99Ns = percentile(0.99);
+    s.p999Ns = percentile(0.999);
+    return s;
+}
+
+void LatencyHistogram::reset() {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace oc::hal::net
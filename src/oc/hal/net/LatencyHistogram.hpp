@@ -0,0 +1,91 @@
+#pragma once
+
+/**
+ * @file LatencyHistogram.hpp
+ * @brief Lock-free log-linear (HDR-style) latency histogram
+ *
+ * Records nanosecond durations into 64 linear sub-buckets per power of
+ * two (worst-case relative error ~3%), covering the full uint64_t range
+ * in a fixed 15 KB table. record() is wait-free apart from the max/min
+ * CAS loops and may be called from any thread; percentiles can be read
+ * concurrently.
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * LatencyHistogram hist;
+ * hist.record(rttNs);
+ *
+ * LatencySummary s = hist.summary();
+ * OC_LOG_INFO("p50={}ns p99={}ns max={}ns", s.p50Ns, s.p99Ns, s.maxNs);
+ * ```
+ */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace oc::hal::net {
+
+/**
+ * @brief Percentile snapshot of a LatencyHistogram
+ *
+ * Percentiles report the upper bound of the matching bucket.
+ */
+struct LatencySummary {
+    uint64_t count = 0;
+    uint64_t minNs = 0;
+    uint64_t meanNs = 0;
+    uint64_t p50Ns = 0;
+    uint64_t p90Ns = 0;
+    uint64_t p99Ns = 0;
+    uint64_t p999Ns = 0;
+    uint64_t maxNs = 0;
+};
+
+class LatencyHistogram {
+public:
+    /// Linear sub-buckets per power of two = 2^kSubBucketBits
+    static constexpr unsigned kSubBucketBits = 6;
+    static constexpr size_t kSubBucketCount = size_t{1} << kSubBucketBits;
+    static constexpr size_t kSubBucketHalf = kSubBucketCount / 2;
+    static constexpr size_t kBucketCount =
+        kSubBucketCount + (64 - kSubBucketBits) * kSubBucketHalf;
+
+    LatencyHistogram() { reset(); }
+
+    // Non-copyable (atomics, large table)
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    /// Record one duration in nanoseconds
+    void record(uint64_t ns);
+
+    /// Value at quantile q in [0, 1] (0 if empty)
+    uint64_t percentile(double q) const;
+
+    /// count/min/mean/p50/p90/p99/p999/max in one pass
+    LatencySummary summary() const;
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+
+    /// Clear all recorded values (not atomic with respect to concurrent record())
+    void reset();
+
+    /// Bucket index for a value (exposed for testing/inspection)
+    static size_t bucketIndex(uint64_t ns);
+
+    /// Highest value that maps to the given bucket
+    static uint64_t bucketUpperBound(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, kBucketCount> buckets_;
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> min_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+}  // namespace oc::hal::net
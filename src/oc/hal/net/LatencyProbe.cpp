@@ -0,0 +1,156 @@
+#include "LatencyProbe.hpp"
+
+#include <chrono>
+#include <cstring>
+
+#include <oc/time/Time.hpp>
+
+namespace oc::hal::net {
+
+namespace {
+
+constexpr uint8_t kMagic[4] = {'O', 'C', 'L', 'P'};
+constexpr uint8_t kTypeRequest = 1;
+constexpr uint8_t kTypeReply = 2;
+
+constexpr size_t kTypeOffset = 4;
+constexpr size_t kOriginOffset = 8;
+constexpr size_t kSeqOffset = 12;
+constexpr size_t kTimeOffset = 16;
+
+uint64_t nowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void writeLe(uint8_t* out, uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; ++i) {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+uint64_t readLe(const uint8_t* in, size_t bytes) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+        value |= static_cast<uint64_t>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+}  // namespace
+
+LatencyProbe::LatencyProbe(interface::ITransport& inner)
+    : LatencyProbe(inner, LatencyProbeConfig{}) {}
+
+LatencyProbe::LatencyProbe(interface::ITransport& inner, const LatencyProbeConfig& config)
+    : inner_(inner)
+    , config_(config) {
+    // Distinguishes our probes from a peer's; only needs to differ per endpoint
+    uint64_t seed = nowNs() ^ reinterpret_cast<uintptr_t>(this);
+    origin_ = static_cast<uint32_t>(seed ^ (seed >> 32));
+
+    inner_.setOnReceive([this](const uint8_t* data, size_t length) {
+        handleReceive(data, length);
+    });
+}
+
+LatencyProbe::~LatencyProbe() {
+    // The inner transport keeps running after us; drop the callback capturing this
+    inner_.setOnReceive(nullptr);
+}
+
+oc::type::Result<void> LatencyProbe::init() {
+    lastProbeMs_ = oc::time::millis();
+    return inner_.init();
+}
+
+void LatencyProbe::update() {
+    inner_.update();
+
+    if (config_.intervalMs > 0) {
+        uint32_t now = oc::time::millis();
+        if (now - lastProbeMs_ >= config_.intervalMs) {
+            lastProbeMs_ = now;
+            sendProbe();
+        }
+    }
+}
+
+void LatencyProbe::send(const uint8_t* data, size_t length) {
+    inner_.send(data, length);
+}
+
+void LatencyProbe::setOnReceive(ReceiveCallback cb) {
+    onReceive_ = std::move(cb);
+}
+
+void LatencyProbe::sendProbe() {
+    if (!inner_.isReady()) {
+        return;
+    }
+
+    uint8_t frame[kProbeSize] = {};
+    memcpy(frame, kMagic, sizeof(kMagic));
+    frame[kTypeOffset] = kTypeRequest;
+    writeLe(frame + kOriginOffset, origin_, 4);
+    uint32_t seq = nextSeq_++;
+    writeLe(frame + kSeqOffset, seq, 4);
+    writeLe(frame + kTimeOffset, nowNs(), 8);
+    // Reuses the slot of the probe kProbeWindow back, which is now stale
+    outstanding_ |= uint64_t{1} << (seq % kProbeWindow);
+
+    inner_.send(frame, sizeof(frame));
+    probesSent_++;
+}
+
+void LatencyProbe::reset() {
+    histogram_.reset();
+    probesSent_ = 0;
+    probesMatched_ = 0;
+    probesDiscarded_ = 0;
+    outstanding_ = 0;
+}
+
+bool LatencyProbe::isProbe(const uint8_t* data, size_t length) {
+    return length == kProbeSize && memcmp(data, kMagic, sizeof(kMagic)) == 0;
+}
+
+void LatencyProbe::handleReceive(const uint8_t* data, size_t length) {
+    if (!isProbe(data, length)) {
+        if (onReceive_) {
+            onReceive_(data, length);
+        }
+        return;
+    }
+
+    uint32_t origin = static_cast<uint32_t>(readLe(data + kOriginOffset, 4));
+    if (origin == origin_) {
+        // Our own probe coming back (reply, or request echoed unchanged).
+        // Only the first reply to a recent probe counts: duplicates would
+        // be recorded twice and skew the tail percentiles.
+        uint32_t seq = static_cast<uint32_t>(readLe(data + kSeqOffset, 4));
+        uint64_t bit = uint64_t{1} << (seq % kProbeWindow);
+        if (nextSeq_ - 1 - seq >= kProbeWindow || (outstanding_ & bit) == 0) {
+            probesDiscarded_++;
+            return;
+        }
+        outstanding_ &= ~bit;
+
+        uint64_t sentNs = readLe(data + kTimeOffset, 8);
+        uint64_t now = nowNs();
+        if (sentNs <= now) {
+            histogram_.record(now - sentNs);
+            probesMatched_++;
+        }
+        return;
+    }
+
+    if (data[kTypeOffset] == kTypeRequest && config_.echoRequests) {
+        uint8_t reply[kProbeSize];
+        memcpy(reply, data, kProbeSize);
+        reply[kTypeOffset] = kTypeReply;
+        inner_.send(reply, sizeof(reply));
+    }
+}
+
+}  // namespace oc::hal::net
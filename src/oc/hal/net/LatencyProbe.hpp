@@ -0,0 +1,141 @@
+#pragma once
+
+/**
+ * @file LatencyProbe.hpp
+ * @brief Opt-in round-trip latency instrumentation for any ITransport
+ *
+ * Wraps an existing transport and interleaves small probe frames with
+ * regular traffic. A probe carries its send time; when the peer echoes
+ * it back, the round-trip time is recorded into a LatencyHistogram and
+ * the echo is swallowed (never reaches the application callback).
+ *
+ * Works identically over UdpTransport and WebSocketTransport, so the
+ * two can be compared with the same numbers.
+ *
+ * ## Probe Frame (24 bytes, little-endian)
+ *
+ * ```
+ * [ 'O' 'C' 'L' 'P' ][ type:u8 ][ 0 0 0 ][ origin:u32 ][ seq:u32 ][ sentNs:u64 ]
+ * ```
+ *
+ * type = 1 (request) or 2 (reply); origin identifies the probing
+ * instance. A LatencyProbe with echoRequests enabled answers requests
+ * from other origins, so two instrumented endpoints can measure each
+ * other. Any other peer just has to send the frame back unchanged (or
+ * with type rewritten to 2).
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * LatencyProbeConfig probeConfig;
+ * probeConfig.intervalMs = 100;
+ *
+ * UdpTransport udp(config);
+ * LatencyProbe probe(udp, probeConfig);
+ * probe.init();
+ * probe.setOnReceive(handleFrame);  // Application frames only
+ *
+ * // In main loop
+ * probe.update();                   // Polls udp, sends probes on schedule
+ *
+ * LatencySummary rtt = probe.histogram().summary();
+ * ```
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <oc/type/Result.hpp>
+#include <oc/interface/ITransport.hpp>
+
+#include "LatencyHistogram.hpp"
+
+namespace oc::hal::net {
+
+/**
+ * @brief Configuration for LatencyProbe
+ */
+struct LatencyProbeConfig {
+    /// Automatic probe interval (ms), 0 = only on explicit sendProbe()
+    uint32_t intervalMs = 1000;
+
+    /// Reply to probe requests received from the peer
+    bool echoRequests = true;
+};
+
+/**
+ * @brief ITransport decorator measuring round-trip latency with probe frames
+ *
+ * The wrapped transport must outlive the probe. The probe installs its
+ * own receive callback on the inner transport and clears it again on
+ * destruction.
+ */
+class LatencyProbe : public interface::ITransport {
+public:
+    static constexpr size_t kProbeSize = 24;
+
+    /// Probes tracked for matching; replies to older ones are ignored
+    static constexpr uint32_t kProbeWindow = 64;
+
+    explicit LatencyProbe(interface::ITransport& inner);
+    LatencyProbe(interface::ITransport& inner, const LatencyProbeConfig& config);
+    ~LatencyProbe() override;
+
+    // Non-copyable, non-movable (inner callback captures this)
+    LatencyProbe(const LatencyProbe&) = delete;
+    LatencyProbe& operator=(const LatencyProbe&) = delete;
+    LatencyProbe(LatencyProbe&&) = delete;
+    LatencyProbe& operator=(LatencyProbe&&) = delete;
+
+    oc::type::Result<void> init() override;
+
+    /**
+     * @brief Update the inner transport and send a probe when due
+     */
+    void update() override;
+
+    void send(const uint8_t* data, size_t length) override;
+    void setOnReceive(ReceiveCallback cb) override;
+    bool isReady() const override { return inner_.isReady(); }
+
+    /**
+     * @brief Send one probe request now (no-op if the transport is not ready)
+     */
+    void sendProbe();
+
+    /// Round-trip times of matched probes
+    const LatencyHistogram& histogram() const { return histogram_; }
+
+    /// Clear recorded round-trip times and probe counters
+    void reset();
+
+    /// Probe requests sent
+    uint64_t probesSent() const { return probesSent_; }
+
+    /// Probe replies received (probesSent - probesMatched = lost or in flight)
+    uint64_t probesMatched() const { return probesMatched_; }
+
+    /// Replies ignored as duplicates or older than kProbeWindow probes
+    uint64_t probesDiscarded() const { return probesDiscarded_; }
+
+    /// Check whether a frame is a probe (request or reply)
+    static bool isProbe(const uint8_t* data, size_t length);
+
+private:
+    void handleReceive(const uint8_t* data, size_t length);
+
+    interface::ITransport& inner_;
+    LatencyProbeConfig config_;
+    ReceiveCallback onReceive_;
+
+    LatencyHistogram histogram_;
+    uint32_t origin_ = 0;
+    uint32_t nextSeq_ = 0;
+    uint64_t probesSent_ = 0;
+    uint64_t probesMatched_ = 0;
+    uint64_t probesDiscarded_ = 0;
+    uint64_t outstanding_ = 0;  ///< Bit seq % kProbeWindow set while awaiting its reply
+    uint32_t lastProbeMs_ = 0;
+};
+
+}  // namespace oc::hal::net
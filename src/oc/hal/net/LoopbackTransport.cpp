@@ -0,0 +1,55 @@
+#include "LoopbackTransport.hpp"
+
+namespace oc::hal::net {
+
+// ═══════════════════════════════════════════════════════════════════════════
+// LoopbackTransport
+// ═══════════════════════════════════════════════════════════════════════════
+
+oc::type::Result<void> LoopbackTransport::init() {
+    return oc::type::Result<void>::ok();
+}
+
+void LoopbackTransport::update() {
+    if (!onReceive_) {
+        return;
+    }
+
+    incoming_.drain([this](const uint8_t* data, size_t length) {
+        counters_.onReceive(length);
+        onReceive_(data, length);
+    }, maxFramesPerUpdate_);
+}
+
+void LoopbackTransport::send(const uint8_t* data, size_t length) {
+    if (outgoing_.tryPush(data, length)) {
+        counters_.onSend(length);
+    } else {
+        counters_.onSendError();
+    }
+}
+
+void LoopbackTransport::setOnReceive(ReceiveCallback cb) {
+    onReceive_ = std::move(cb);
+}
+
+TransportStats LoopbackTransport::stats() const {
+    TransportStats s = counters_.snapshot();
+    s.bufferedFrames = incoming_.size();
+    return s;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// LoopbackTransportPair
+// ═══════════════════════════════════════════════════════════════════════════
+
+LoopbackTransportPair::LoopbackTransportPair()
+    : LoopbackTransportPair(LoopbackConfig{}) {}
+
+LoopbackTransportPair::LoopbackTransportPair(const LoopbackConfig& config)
+    : aToB_(config.capacity, config.maxFrameSize, config.memoryResource)
+    , bToA_(config.capacity, config.maxFrameSize, config.memoryResource)
+    , a_(bToA_, aToB_, config.maxFramesPerUpdate)
+    , b_(aToB_, bToA_, config.maxFramesPerUpdate) {}
+
+}  // namespace oc::hal::net
@@ -0,0 +1,203 @@
+#include "MuxTransport.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace oc::hal::net {
+
+namespace {
+
+constexpr size_t kMaxChannels = 256;  // One-byte channel id
+
+}  // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Construction
+// ═══════════════════════════════════════════════════════════════════════════
+
+MuxTransport::MuxTransport(interface::ITransport& inner, const MuxConfig& config)
+    : inner_(inner)
+    , config_(config)
+    , framePool_(16, config.memoryResource) {
+    if (config_.channels.empty()) {
+        config_.channels.resize(1);
+    }
+    if (config_.channels.size() > kMaxChannels) {
+        config_.channels.resize(kMaxChannels);
+    }
+    // A zero quantum would never build up deficit and stall drainClass()
+    config_.quantumBytes = std::max<uint32_t>(config_.quantumBytes, 1);
+
+    std::pmr::memory_resource* resource =
+        config_.memoryResource ? config_.memoryResource : std::pmr::get_default_resource();
+    for (const MuxChannelConfig& c : config_.channels) {
+        channels_.emplace_back(c, resource);
+    }
+
+    // Group channel ids by priority; ties keep id order
+    order_.resize(channels_.size());
+    for (size_t i = 0; i < order_.size(); ++i) {
+        order_[i] = static_cast<uint8_t>(i);
+    }
+    std::stable_sort(order_.begin(), order_.end(), [this](uint8_t a, uint8_t b) {
+        return channels_[a].config.priority < channels_[b].config.priority;
+    });
+    classOf_.resize(channels_.size());
+    for (size_t i = 0; i < order_.size(); ++i) {
+        uint8_t priority = channels_[order_[i]].config.priority;
+        if (classes_.empty() ||
+            channels_[order_[classes_.back().begin]].config.priority != priority) {
+            classes_.push_back(PriorityClass{i, i});
+        }
+        classes_.back().end = i + 1;
+        classOf_[order_[i]] = classes_.size() - 1;
+    }
+
+    inner_.setOnReceive([this](const uint8_t* data, size_t length) {
+        onInnerReceive(data, length);
+    });
+}
+
+MuxTransport::~MuxTransport() {
+    inner_.setOnReceive(nullptr);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ITransport interface
+// ═══════════════════════════════════════════════════════════════════════════
+
+void MuxTransport::update() {
+    inner_.update();
+
+    if (queuedFrames_ == 0 || !inner_.isReady()) {
+        return;
+    }
+
+    Budget budget{config_.maxFramesPerUpdate ? config_.maxFramesPerUpdate : SIZE_MAX,
+                  config_.maxBytesPerUpdate ? config_.maxBytesPerUpdate : SIZE_MAX};
+    for (PriorityClass& cls : classes_) {
+        if (!drainClass(cls, budget)) {
+            break;  // Budget spent; less urgent classes wait for the next update
+        }
+    }
+}
+
+void MuxTransport::setOnReceive(ReceiveCallback cb) {
+    onReceive_ = std::move(cb);
+}
+
+bool MuxTransport::send(uint8_t channel, const uint8_t* data, size_t length) {
+    if (channel >= channels_.size()) {
+        return false;
+    }
+    Channel& c = channels_[channel];
+
+    if (c.queue.size() >= c.config.maxQueuedFrames) {
+        if (c.queue.empty()) {
+            c.stats.dropped++;  // maxQueuedFrames == 0: nothing can be queued
+            return true;
+        }
+        // Drop oldest frame to make room
+        c.queue.pop_front();
+        c.stats.dropped++;
+        classes_[classOf_[channel]].queued--;
+        queuedFrames_--;
+    }
+
+    // Header and payload written straight into the queued frame
+    c.queue.emplace_back(nullptr, size_t{0}, framePool_);
+    uint8_t* wire = c.queue.back().prepare(kHeaderSize + length);
+    wire[0] = channel;
+    if (length > 0) {
+        memcpy(wire + kHeaderSize, data, length);
+    }
+
+    classes_[classOf_[channel]].queued++;
+    queuedFrames_++;
+    c.stats.queued = c.queue.size();
+    c.stats.maxQueued = std::max(c.stats.maxQueued, c.stats.queued);
+    return true;
+}
+
+void MuxTransport::setOnChannelReceive(ChannelReceiveCallback cb) {
+    onChannelReceive_ = std::move(cb);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Scheduler
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool MuxTransport::Budget::take(size_t length) {
+    // The first frame always fits, so one larger than the byte budget can't stall
+    if (frames == 0 || (bytes < length && !first)) {
+        return false;
+    }
+    frames--;
+    bytes = bytes > length ? bytes - length : 0;
+    first = false;
+    return true;
+}
+
+bool MuxTransport::drainClass(PriorityClass& cls, Budget& budget) {
+    const size_t size = cls.end - cls.begin;
+    while (cls.queued > 0) {
+        Channel& c = channels_[order_[cls.begin + cls.cursor]];
+
+        if (!c.queue.empty()) {
+            if (!c.credited) {
+                c.deficit += static_cast<uint64_t>(config_.quantumBytes) *
+                             std::max<uint32_t>(c.config.weight, 1);
+                c.credited = true;
+            }
+            while (!c.queue.empty() && c.queue.front().size() <= c.deficit) {
+                const Frame& frame = c.queue.front();
+                if (!budget.take(frame.size())) {
+                    return false;  // Resume at this channel, credit kept
+                }
+                inner_.send(frame.data(), frame.size());
+                c.deficit -= frame.size();
+                c.stats.txFrames++;
+                c.stats.txBytes += frame.size() - kHeaderSize;
+                c.queue.pop_front();
+                cls.queued--;
+                queuedFrames_--;
+            }
+            c.stats.queued = c.queue.size();
+        }
+
+        // Idle channels don't bank credit (standard DRR)
+        if (c.queue.empty()) {
+            c.deficit = 0;
+        }
+        c.credited = false;
+        cls.cursor = (cls.cursor + 1) % size;
+    }
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Receive Path
+// ═══════════════════════════════════════════════════════════════════════════
+
+void MuxTransport::onInnerReceive(const uint8_t* data, size_t length) {
+    if (length < kHeaderSize || data[0] >= channels_.size()) {
+        malformedFrames_++;
+        return;
+    }
+    uint8_t channel = data[0];
+    const uint8_t* payload = data + kHeaderSize;
+    size_t payloadLength = length - kHeaderSize;
+
+    MuxChannelStats& stats = channels_[channel].stats;
+    stats.rxFrames++;
+    stats.rxBytes += payloadLength;
+
+    if (onChannelReceive_) {
+        onChannelReceive_(channel, payload, payloadLength);
+    } else if (onReceive_) {
+        onReceive_(payload, payloadLength);
+    }
+}
+
+}  // namespace oc::hal::net
@@ -0,0 +1,218 @@
+#pragma once
+
+/**
+ * @file MuxTransport.hpp
+ * @brief ITransport decorator multiplexing prioritized logical channels
+ *
+ * Control messages and bulk streams (meters, waveforms) often share one
+ * transport; without scheduling, a bulk burst queues in front of the next
+ * page-change frame. MuxTransport prefixes every frame with a one-byte
+ * channel id, keeps one queue per channel and drains the queues into the
+ * inner transport on update():
+ *
+ * - Strict priority between priority classes (lower value first): a
+ *   class is only served once every more urgent class is empty
+ * - Deficit round robin by weight between channels of the same class
+ * - Optional per-update frame/byte budget, so bulk traffic is spread
+ *   over several updates instead of flooding the socket at once
+ *
+ * Both ends must use MuxTransport (or the same one-byte header).
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * MuxConfig mux;
+ * mux.channels.resize(2);
+ * mux.channels[0].priority = 0;   // Control
+ * mux.channels[1].priority = 1;   // Meters / waveforms
+ * mux.channels[1].maxQueuedFrames = 64;
+ * mux.maxBytesPerUpdate = 32 * 1024;
+ *
+ * MuxTransport transport(udp, mux);
+ * transport.init();
+ * transport.setOnChannelReceive([](uint8_t channel, const uint8_t* data, size_t len) {
+ *     route(channel, data, len);
+ * });
+ *
+ * transport.send(kControl, pageFrame, pageLen);
+ * transport.send(kMeters, meterFrame, meterLen);
+ * transport.update();  // Control first, then meters within the budget
+ * ```
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory_resource>
+#include <vector>
+
+#include <oc/type/Result.hpp>
+#include <oc/interface/ITransport.hpp>
+
+#include "Frame.hpp"
+
+namespace oc::hal::net {
+
+/**
+ * @brief Scheduling parameters of one channel
+ */
+struct MuxChannelConfig {
+    /// Priority class, 0 = most urgent; lower classes are drained first
+    uint8_t priority = 0;
+
+    /// Share of the bandwidth within its priority class (deficit round robin)
+    uint32_t weight = 1;
+
+    /// Queue bound in frames; the oldest frame is dropped when full
+    size_t maxQueuedFrames = 256;
+};
+
+/**
+ * @brief Configuration for MuxTransport
+ */
+struct MuxConfig {
+    /// One entry per channel, index = channel id (at most 256; empty = one channel)
+    std::vector<MuxChannelConfig> channels;
+
+    /// Frames handed to the inner transport per update() (0 = unlimited)
+    size_t maxFramesPerUpdate = 0;
+
+    /// Wire bytes handed to the inner transport per update() (0 = unlimited)
+    size_t maxBytesPerUpdate = 0;
+
+    /// Deficit round robin quantum per unit of weight (bytes, 0 is treated as 1)
+    uint32_t quantumBytes = 1500;
+
+    /// Allocator for the channel queues (nullptr = default resource).
+    /// Must outlive the transport.
+    std::pmr::memory_resource* memoryResource = nullptr;
+};
+
+/**
+ * @brief Per-channel counters
+ */
+struct MuxChannelStats {
+    uint64_t txFrames = 0;   ///< Frames handed to the inner transport
+    uint64_t txBytes = 0;    ///< Payload bytes (without the channel header)
+    uint64_t rxFrames = 0;
+    uint64_t rxBytes = 0;
+    uint64_t dropped = 0;    ///< Oldest frames discarded at maxQueuedFrames
+    size_t queued = 0;       ///< Frames currently waiting
+    size_t maxQueued = 0;    ///< Queue high-water mark
+};
+
+/**
+ * @brief Channel multiplexer with strict-priority / weighted scheduling
+ *
+ * Demultiplexes through a receive callback it owns on the inner transport
+ * from construction until destruction, so the inner transport must stay
+ * alive for that span (and may be reused afterwards). Single-threaded.
+ */
+class MuxTransport : public interface::ITransport {
+public:
+    using ChannelReceiveCallback =
+        std::function<void(uint8_t channel, const uint8_t* data, size_t length)>;
+
+    /// Bytes prepended to every frame
+    static constexpr size_t kHeaderSize = 1;
+
+    MuxTransport(interface::ITransport& inner, const MuxConfig& config);
+    ~MuxTransport() override;
+
+    // Non-copyable, non-movable (inner callback captures this)
+    MuxTransport(const MuxTransport&) = delete;
+    MuxTransport& operator=(const MuxTransport&) = delete;
+    MuxTransport(MuxTransport&&) = delete;
+    MuxTransport& operator=(MuxTransport&&) = delete;
+
+    oc::type::Result<void> init() override { return inner_.init(); }
+
+    /**
+     * @brief Update the inner transport, then drain the queues by priority
+     *
+     * Nothing is drained while the inner transport is not ready.
+     */
+    void update() override;
+
+    /// Queue a frame on channel 0
+    void send(const uint8_t* data, size_t length) override { send(0, data, length); }
+
+    /// Receives frames of all channels without the channel id
+    void setOnReceive(ReceiveCallback cb) override;
+
+    bool isReady() const override { return inner_.isReady(); }
+
+    /**
+     * @brief Queue a frame on a channel (sent on a later update())
+     *
+     * @return false if channel does not exist
+     */
+    bool send(uint8_t channel, const uint8_t* data, size_t length);
+
+    /// Receive callback with the channel id (takes precedence over setOnReceive())
+    void setOnChannelReceive(ChannelReceiveCallback cb);
+
+    size_t channelCount() const { return channels_.size(); }
+
+    /// Counters of a channel (channel must be < channelCount())
+    const MuxChannelStats& channelStats(uint8_t channel) const {
+        return channels_[channel].stats;
+    }
+
+    /// Frames waiting in all queues
+    size_t queuedFrames() const { return queuedFrames_; }
+
+    /// Received frames that were empty or named an unknown channel
+    uint64_t malformedFrames() const { return malformedFrames_; }
+
+private:
+    struct Channel {
+        Channel(const MuxChannelConfig& c, std::pmr::memory_resource* resource)
+            : config(c), queue(resource) {}
+
+        MuxChannelConfig config;
+        std::pmr::deque<Frame> queue;  ///< Frames including the channel header
+        uint64_t deficit = 0;
+        bool credited = false;  ///< Quantum already added in the current round
+        MuxChannelStats stats;
+    };
+
+    /// Channels sharing a priority: order_[begin, end), served round robin
+    struct PriorityClass {
+        size_t begin;
+        size_t end;
+        size_t cursor = 0;
+        size_t queued = 0;
+    };
+
+    /// Remaining per-update budget (SIZE_MAX = unlimited)
+    struct Budget {
+        size_t frames;
+        size_t bytes;
+        bool first = true;
+
+        /// Charge one frame, false if it no longer fits
+        bool take(size_t length);
+    };
+
+    /// Deficit round robin over one class; false if the budget ran out
+    bool drainClass(PriorityClass& cls, Budget& budget);
+
+    void onInnerReceive(const uint8_t* data, size_t length);
+
+    interface::ITransport& inner_;
+    MuxConfig config_;
+    FramePool framePool_;
+    std::deque<Channel> channels_;         ///< Deque: Channel is not movable
+    std::vector<uint8_t> order_;          ///< Channel ids sorted by priority
+    std::vector<PriorityClass> classes_;  ///< Most urgent first
+    std::vector<size_t> classOf_;         ///< Channel id -> index into classes_
+    size_t queuedFrames_ = 0;
+    uint64_t malformedFrames_ = 0;
+
+    ReceiveCallback onReceive_;
+    ChannelReceiveCallback onChannelReceive_;
+};
+
+}  // namespace oc::hal::net
@@ -0,0 +1,172 @@
+#include "PacedTransport.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace oc::hal::net {
+
+namespace {
+
+constexpr int64_t kScale = 1000000;  // Bucket credit units per token (1 token/s = 1 unit/us)
+
+}  // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Bucket
+// ═══════════════════════════════════════════════════════════════════════════
+
+void PacedTransport::Bucket::configure(uint64_t unitsPerSec, uint64_t depth) {
+    rate = unitsPerSec;
+    capacity = static_cast<int64_t>(depth) * kScale;
+    credit = std::min(credit, capacity);
+}
+
+void PacedTransport::Bucket::refill(uint64_t elapsedUs) {
+    if (rate == 0 || credit >= capacity) {
+        return;
+    }
+    // Compare before multiplying: a long idle period would overflow elapsedUs * rate
+    uint64_t room = static_cast<uint64_t>(capacity - credit);
+    if (elapsedUs >= room / rate + 1) {
+        credit = capacity;
+    } else {
+        credit = std::min(capacity, credit + static_cast<int64_t>(elapsedUs * rate));
+    }
+}
+
+bool PacedTransport::Bucket::allows(uint64_t units) const {
+    // A frame larger than the bucket goes out once the bucket is full
+    return rate == 0 || credit >= std::min(static_cast<int64_t>(units) * kScale, capacity);
+}
+
+void PacedTransport::Bucket::charge(uint64_t units) {
+    if (rate != 0) {
+        credit -= static_cast<int64_t>(units) * kScale;
+    }
+}
+
+uint64_t PacedTransport::Bucket::waitUs(uint64_t units) const {
+    if (allows(units)) {
+        return 0;
+    }
+    int64_t needed = std::min(static_cast<int64_t>(units) * kScale, capacity) - credit;
+    return (static_cast<uint64_t>(needed) + rate - 1) / rate;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PacedTransport
+// ═══════════════════════════════════════════════════════════════════════════
+
+PacedTransport::PacedTransport(interface::ITransport& inner, const PacingConfig& config)
+    : inner_(inner)
+    , config_(config)
+    , framePool_(16, config.memoryResource)
+    , queue_(config.memoryResource ? config.memoryResource
+                                   : std::pmr::get_default_resource()) {
+    setRates(config_.bytesPerSec, config_.framesPerSec);
+
+    // Start with full buckets: the first burst goes out unpaced
+    bytes_.credit = bytes_.capacity;
+    frames_.credit = frames_.capacity;
+    lastRefillUs_ = now();
+}
+
+void PacedTransport::setRates(uint64_t bytesPerSec, uint32_t framesPerSec) {
+    config_.bytesPerSec = bytesPerSec;
+    config_.framesPerSec = framesPerSec;
+
+    uint64_t byteDepth = config_.burstBytes > 0
+                             ? config_.burstBytes
+                             : std::max<uint64_t>(bytesPerSec / 100, 1500);
+    uint64_t frameDepth = config_.burstFrames > 0
+                              ? config_.burstFrames
+                              : std::max<uint64_t>(framesPerSec / 100, 1);
+    bytes_.configure(bytesPerSec, byteDepth);
+    frames_.configure(framesPerSec, frameDepth);
+}
+
+void PacedTransport::update() {
+    inner_.update();
+
+    if (queue_.empty()) {
+        return;
+    }
+    uint64_t t = now();
+    refill(t);
+    while (!queue_.empty() && conforms(queue_.front().frame.size())) {
+        Queued& head = queue_.front();
+        queueDelay_.record((t - head.enqueuedUs) * 1000);
+        stats_.queuedBytes -= head.frame.size();
+        transmit(head.frame.data(), head.frame.size());
+        queue_.pop_front();
+    }
+    stats_.queuedFrames = queue_.size();
+}
+
+void PacedTransport::send(const uint8_t* data, size_t length) {
+    uint64_t t = now();
+    refill(t);
+
+    // FIFO: nothing overtakes a queued frame
+    if (queue_.empty() && conforms(length)) {
+        queueDelay_.record(0);
+        transmit(data, length);
+        return;
+    }
+
+    if (config_.maxQueuedFrames > 0 && queue_.size() >= config_.maxQueuedFrames) {
+        stats_.droppedFrames++;
+        return;
+    }
+    queue_.emplace_back(data, length, framePool_, t);
+    stats_.delayedFrames++;
+    stats_.queuedFrames = queue_.size();
+    stats_.queuedBytes += length;
+    stats_.maxQueuedFrames = std::max(stats_.maxQueuedFrames, stats_.queuedFrames);
+}
+
+uint64_t PacedTransport::nextReleaseInUs() const {
+    if (queue_.empty()) {
+        return std::numeric_limits<uint64_t>::max();
+    }
+
+    // Buckets as they would be now, without mutating them
+    uint64_t elapsedUs = now() - lastRefillUs_;
+    Bucket bytes = bytes_;
+    Bucket frames = frames_;
+    bytes.refill(elapsedUs);
+    frames.refill(elapsedUs);
+
+    size_t length = queue_.front().frame.size();
+    return std::max(bytes.waitUs(length), frames.waitUs(1));
+}
+
+void PacedTransport::refill(uint64_t t) {
+    uint64_t elapsedUs = t - lastRefillUs_;
+    lastRefillUs_ = t;
+    bytes_.refill(elapsedUs);
+    frames_.refill(elapsedUs);
+}
+
+bool PacedTransport::conforms(size_t length) const {
+    return bytes_.allows(length) && frames_.allows(1);
+}
+
+void PacedTransport::transmit(const uint8_t* data, size_t length) {
+    bytes_.charge(length);
+    frames_.charge(1);
+    inner_.send(data, length);
+    stats_.sentFrames++;
+    stats_.sentBytes += length;
+}
+
+uint64_t PacedTransport::now() const {
+    if (config_.clock) {
+        return config_.clock();
+    }
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+}  // namespace oc::hal::net
@@ -0,0 +1,174 @@
+#pragma once
+
+/**
+ * @file PacedTransport.hpp
+ * @brief ITransport decorator pacing sends with a token bucket
+ *
+ * A full-state dump calls send() a thousand times in one go; the peer's
+ * socket buffer overflows and frames are lost. PacedTransport limits the
+ * send path to a byte rate and/or a frame rate with a token bucket each:
+ * frames that conform are sent immediately, the rest wait in a queue and
+ * are released by update() as tokens accrue, at microsecond resolution.
+ * Every frame's queueing delay is recorded in a LatencyHistogram.
+ *
+ * Time comes from an injectable microsecond clock, like ImpairedTransport.
+ * The receive path is passed through untouched.
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * PacingConfig pacing;
+ * pacing.bytesPerSec = 2 * 1024 * 1024;
+ * pacing.framesPerSec = 5000;
+ *
+ * PacedTransport transport(udp, pacing);
+ * transport.init();
+ *
+ * for (auto& f : stateDump) transport.send(f.data, f.len);  // Queued, not dropped
+ *
+ * // In main loop (call often, or sleep nextReleaseInUs())
+ * transport.update();
+ * LatencySummary delay = transport.queueDelay().summary();
+ * ```
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory_resource>
+
+#include <oc/type/Result.hpp>
+#include <oc/interface/ITransport.hpp>
+
+#include "Frame.hpp"
+#include "LatencyHistogram.hpp"
+
+namespace oc::hal::net {
+
+/**
+ * @brief Configuration for PacedTransport
+ *
+ * A rate of 0 disables that limit; with both at 0 frames pass straight through.
+ */
+struct PacingConfig {
+    /// Sustained send rate in payload bytes per second
+    uint64_t bytesPerSec = 0;
+
+    /// Sustained send rate in frames per second
+    uint32_t framesPerSec = 0;
+
+    /// Byte bucket depth = largest burst sent back to back
+    /// (0 = 10 ms worth, at least 1500 bytes)
+    size_t burstBytes = 0;
+
+    /// Frame bucket depth (0 = 10 ms worth, at least 1 frame)
+    uint32_t burstFrames = 0;
+
+    /// Queue bound; further frames are dropped (0 = unbounded)
+    size_t maxQueuedFrames = 4096;
+
+    /// Microsecond clock (default: steady_clock)
+    std::function<uint64_t()> clock;
+
+    /// Allocator for the queue (nullptr = default resource). Must outlive the transport.
+    std::pmr::memory_resource* memoryResource = nullptr;
+};
+
+/**
+ * @brief Send-side pacing counters
+ */
+struct PacingStats {
+    uint64_t sentFrames = 0;
+    uint64_t sentBytes = 0;
+    uint64_t delayedFrames = 0;  ///< Frames that had to wait for tokens
+    uint64_t droppedFrames = 0;  ///< Rejected at maxQueuedFrames
+    size_t queuedFrames = 0;     ///< Currently waiting
+    size_t queuedBytes = 0;
+    size_t maxQueuedFrames = 0;  ///< Queue high-water mark
+};
+
+/**
+ * @brief Token-bucket pacing decorator
+ *
+ * The wrapped transport must outlive the decorator. Single-threaded,
+ * except queueDelay() which may be read from any thread.
+ */
+class PacedTransport : public interface::ITransport {
+public:
+    PacedTransport(interface::ITransport& inner, const PacingConfig& config);
+    ~PacedTransport() override = default;
+
+    // Non-copyable, non-movable (holds a reference and a histogram)
+    PacedTransport(const PacedTransport&) = delete;
+    PacedTransport& operator=(const PacedTransport&) = delete;
+    PacedTransport(PacedTransport&&) = delete;
+    PacedTransport& operator=(PacedTransport&&) = delete;
+
+    oc::type::Result<void> init() override { return inner_.init(); }
+
+    /**
+     * @brief Update the inner transport, then release every frame the buckets allow
+     */
+    void update() override;
+
+    /**
+     * @brief Send now if the buckets allow and nothing is queued, else queue
+     */
+    void send(const uint8_t* data, size_t length) override;
+
+    void setOnReceive(ReceiveCallback cb) override { inner_.setOnReceive(std::move(cb)); }
+    bool isReady() const override { return inner_.isReady(); }
+
+    const PacingStats& stats() const { return stats_; }
+
+    /// Time each frame spent queued (ns; 0 for frames sent immediately)
+    const LatencyHistogram& queueDelay() const { return queueDelay_; }
+
+    /// Microseconds until the head frame may be sent (UINT64_MAX if none queued)
+    uint64_t nextReleaseInUs() const;
+
+    /// Change the rates at runtime (bucket contents are kept, clamped to the new depth)
+    void setRates(uint64_t bytesPerSec, uint32_t framesPerSec);
+
+private:
+    /// One token bucket; credit is in units x 1e6 so refills stay exact per microsecond
+    struct Bucket {
+        uint64_t rate = 0;      ///< Units per second, 0 = unlimited
+        int64_t capacity = 0;   ///< Depth x 1e6
+        int64_t credit = 0;     ///< May go negative after an oversized frame
+
+        void configure(uint64_t unitsPerSec, uint64_t depth);
+        void refill(uint64_t elapsedUs);
+        bool allows(uint64_t units) const;
+        void charge(uint64_t units);
+        uint64_t waitUs(uint64_t units) const;
+    };
+
+    struct Queued {
+        Queued(const uint8_t* data, size_t length, FramePool& pool, uint64_t t)
+            : frame(data, length, pool), enqueuedUs(t) {}
+
+        Frame frame;
+        uint64_t enqueuedUs;
+    };
+
+    void refill(uint64_t t);
+    bool conforms(size_t length) const;
+    void transmit(const uint8_t* data, size_t length);
+    uint64_t now() const;
+
+    interface::ITransport& inner_;
+    PacingConfig config_;
+    FramePool framePool_;
+    std::pmr::deque<Queued> queue_;
+
+    Bucket bytes_;
+    Bucket frames_;
+    uint64_t lastRefillUs_ = 0;
+
+    PacingStats stats_;
+    LatencyHistogram queueDelay_;
+};
+
+}  // namespace oc::hal::net
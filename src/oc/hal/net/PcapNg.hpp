@@ -0,0 +1,148 @@
+#pragma once
+
+/**
+ * @file PcapNg.hpp
+ * @brief Minimal pcapng block layout shared by CaptureWriter and ReplayTransport
+ *
+ * Only the subset needed for transport frames is produced/understood:
+ * one Section Header Block, one Interface Description Block (link type
+ * USER0, nanosecond resolution) and Enhanced Packet Blocks carrying the
+ * direction in epb_flags. Files open directly in Wireshark. Readers honour
+ * if_tsresol, so captures from other tools replay with correct timing.
+ *
+ * Blocks are written in host byte order (the SHB byte-order magic tells
+ * readers which one).
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace oc::hal::net::pcapng {
+
+constexpr uint32_t kSectionHeaderBlock = 0x0A0D0D0A;
+constexpr uint32_t kInterfaceDescriptionBlock = 0x00000001;
+constexpr uint32_t kEnhancedPacketBlock = 0x00000006;
+constexpr uint32_t kByteOrderMagic = 0x1A2B3C4D;
+
+/// LINKTYPE_USER0: raw frames without any link-layer header
+constexpr uint16_t kLinkTypeUser0 = 147;
+
+constexpr uint16_t kOptEndOfOpt = 0;
+constexpr uint16_t kOptIfTsResol = 9;
+constexpr uint16_t kOptEpbFlags = 2;
+
+/// Timestamp resolution of an IDB without if_tsresol (microseconds)
+constexpr uint8_t kDefaultTsResol = 6;
+
+/// epb_flags direction bits
+constexpr uint32_t kFlagInbound = 0x1;
+constexpr uint32_t kFlagOutbound = 0x2;
+constexpr uint32_t kFlagDirectionMask = 0x3;
+
+/// Fixed EPB size without packet data: header, fields, epb_flags, end-of-opt, trailer
+constexpr size_t kEpbOverhead = 8 + 20 + 8 + 4 + 4;
+
+inline size_t padded(size_t length) { return (length + 3) & ~size_t{3}; }
+
+inline void put16(std::vector<uint8_t>& out, uint16_t value) {
+    uint8_t bytes[2];
+    memcpy(bytes, &value, sizeof(bytes));
+    out.insert(out.end(), bytes, bytes + sizeof(bytes));
+}
+
+inline void put32(std::vector<uint8_t>& out, uint32_t value) {
+    uint8_t bytes[4];
+    memcpy(bytes, &value, sizeof(bytes));
+    out.insert(out.end(), bytes, bytes + sizeof(bytes));
+}
+
+inline uint32_t get32(const uint8_t* in) {
+    uint32_t value;
+    memcpy(&value, in, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Convert an EPB timestamp to nanoseconds
+ *
+ * @param ticks Timestamp in units of the interface's if_tsresol
+ * @param tsresol if_tsresol value: 10^-n seconds, or 2^-n with the MSB set
+ */
+inline uint64_t toNanoseconds(uint64_t ticks, uint8_t tsresol) {
+    constexpr uint64_t kNsPerSecond = 1000000000ull;
+    unsigned exponent = tsresol & 0x7Fu;
+
+    if (tsresol & 0x80u) {
+        if (exponent > 63) {
+            return 0;
+        }
+        uint64_t seconds = ticks >> exponent;
+        uint64_t fraction = ticks & ((uint64_t{1} << exponent) - 1);
+        // Keep at most 32 fraction bits so the product fits in 64 bits
+        unsigned drop = exponent > 32 ? exponent - 32 : 0;
+        return seconds * kNsPerSecond + (((fraction >> drop) * kNsPerSecond) >> (exponent - drop));
+    }
+
+    uint64_t scale = 1;
+    if (exponent <= 9) {
+        for (unsigned i = exponent; i < 9; ++i) scale *= 10;
+        return ticks * scale;
+    }
+    if (exponent > 28) {
+        return 0;
+    }
+    for (unsigned i = 9; i < exponent; ++i) scale *= 10;
+    return ticks / scale;
+}
+
+/// Section Header + Interface Description blocks that start every file
+inline void appendFileHeader(std::vector<uint8_t>& out) {
+    // SHB: type, length, byte-order magic, version 1.0, section length -1
+    put32(out, kSectionHeaderBlock);
+    put32(out, 28);
+    put32(out, kByteOrderMagic);
+    put16(out, 1);
+    put16(out, 0);
+    put32(out, 0xFFFFFFFF);
+    put32(out, 0xFFFFFFFF);
+    put32(out, 28);
+
+    // IDB: link type, reserved, snaplen 0, if_tsresol = 9 (nanoseconds)
+    put32(out, kInterfaceDescriptionBlock);
+    put32(out, 32);
+    put16(out, kLinkTypeUser0);
+    put16(out, 0);
+    put32(out, 0);
+    put16(out, kOptIfTsResol);
+    put16(out, 1);
+    out.push_back(9);
+    out.insert(out.end(), 3, 0);
+    put16(out, kOptEndOfOpt);
+    put16(out, 0);
+    put32(out, 32);
+}
+
+/// One Enhanced Packet Block (interface 0, timestamp in ns since epoch)
+inline void appendPacket(std::vector<uint8_t>& out, uint64_t timestampNs, uint32_t flags,
+                         const uint8_t* data, size_t length) {
+    uint32_t total = static_cast<uint32_t>(kEpbOverhead + padded(length));
+    put32(out, kEnhancedPacketBlock);
+    put32(out, total);
+    put32(out, 0);
+    put32(out, static_cast<uint32_t>(timestampNs >> 32));
+    put32(out, static_cast<uint32_t>(timestampNs));
+    put32(out, static_cast<uint32_t>(length));
+    put32(out, static_cast<uint32_t>(length));
+    out.insert(out.end(), data, data + length);
+    out.insert(out.end(), padded(length) - length, 0);
+    put16(out, kOptEpbFlags);
+    put16(out, 4);
+    put32(out, flags);
+    put16(out, kOptEndOfOpt);
+    put16(out, 0);
+    put32(out, total);
+}
+
+}  // namespace oc::hal::net::pcapng
@@ -0,0 +1,17 @@
+/**
+ * @file RateLimitedLog.cpp
+ * @brief Rate-limited log site clock handling
+ */
+
+#include "RateLimitedLog.hpp"
+
+#include <oc/time/Time.hpp>
+
+namespace oc::hal::net {
+
+bool RateLimitedLogSite::intervalElapsed(uint32_t& now) const {
+    now = oc::time::millis();
+    return !emitted_ || now - lastEmitMs_ >= intervalMs_;
+}
+
+}  // namespace oc::hal::net
@@ -0,0 +1,128 @@
+#pragma once
+
+/**
+ * @file RateLimitedLog.hpp
+ * @brief Counted, rate-limited log sites for transport hot paths
+ *
+ * A failing peer makes send() fail on every frame; logging each one
+ * formats thousands of lines per second exactly when the main loop can
+ * least afford it. A RateLimitedLogSite splits the two halves:
+ *
+ * - hit() on the hot path only bumps a counter and stores the last
+ *   error value - no formatting, no clock read
+ * - flush() from update() emits at most one summary line per interval
+ *   with the number of occurrences it stands for
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * // send()
+ * if (failed) sendFailedLog_.hit(errno);
+ *
+ * // update()
+ * sendFailedLog_.flush([](uint64_t count, int64_t lastError) {
+ *     OC_LOG_WARN("UDP: Send failed: {} ({}x)", lastError, count);
+ * });
+ * ```
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace oc::hal::net {
+
+/**
+ * @brief One log call site with occurrence counting and a minimum interval
+ *
+ * hit() and flush() may run on different threads (sender vs. update loop).
+ * Copying transfers the pending count so owning transports stay movable.
+ */
+class RateLimitedLogSite {
+public:
+    /// @param intervalMs Minimum time between two emitted lines (0 = every flush)
+    explicit RateLimitedLogSite(uint32_t intervalMs = 1000) : intervalMs_(intervalMs) {}
+
+    RateLimitedLogSite(const RateLimitedLogSite& other)
+        : intervalMs_(other.intervalMs_)
+        , pending_(other.pending_.load(std::memory_order_relaxed))
+        , lastValue_(other.lastValue_.load(std::memory_order_relaxed))
+        , lastEmitMs_(other.lastEmitMs_)
+        , emitted_(other.emitted_) {}
+
+    RateLimitedLogSite& operator=(const RateLimitedLogSite& other) {
+        if (this != &other) {
+            intervalMs_ = other.intervalMs_;
+            pending_.store(other.pending_.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+            lastValue_.store(other.lastValue_.load(std::memory_order_relaxed),
+                             std::memory_order_relaxed);
+            lastEmitMs_ = other.lastEmitMs_;
+            emitted_ = other.emitted_;
+        }
+        return *this;
+    }
+
+    /// Record one occurrence (hot path)
+    void hit(int64_t value = 0) {
+        lastValue_.store(value, std::memory_order_relaxed);
+        pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Emit a summary if occurrences are pending and the interval has passed
+     *
+     * @param emit Called as emit(count, lastValue); does the actual formatting
+     * @return true if a line was emitted
+     */
+    template <typename Emit>
+    bool flush(Emit&& emit) {
+        if (pending_.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+        uint32_t now;
+        if (!intervalElapsed(now)) {
+            return false;
+        }
+        uint64_t count = pending_.exchange(0, std::memory_order_relaxed);
+        emit(count, lastValue_.load(std::memory_order_relaxed));
+        lastEmitMs_ = now;
+        emitted_ = true;
+        return true;
+    }
+
+    /// Occurrences not yet reported
+    uint64_t pending() const { return pending_.load(std::memory_order_relaxed); }
+
+private:
+    /// Read the clock into now, true if a line may be emitted (out of line
+    /// so this header does not depend on oc/time)
+    bool intervalElapsed(uint32_t& now) const;
+
+    uint32_t intervalMs_;
+    std::atomic<uint64_t> pending_{0};
+    std::atomic<int64_t> lastValue_{0};
+    uint32_t lastEmitMs_ = 0;
+    bool emitted_ = false;
+};
+
+/**
+ * @brief Drop-in RateLimitedLogSite replacement that records nothing
+ *
+ * Used by the policy-templated transports when logging is compiled out.
+ */
+class NullRateLimitedLogSite {
+public:
+    explicit NullRateLimitedLogSite(uint32_t = 1000) {}
+    void hit(int64_t = 0) {}
+    template <typename Emit>
+    bool flush(Emit&&) { return false; }
+    uint64_t pending() const { return 0; }
+};
+
+/// RateLimitedLogSite if Enabled, NullRateLimitedLogSite otherwise
+template <bool Enabled>
+using RateLimitedLogSiteFor =
+    std::conditional_t<Enabled, RateLimitedLogSite, NullRateLimitedLogSite>;
+
+}  // namespace oc::hal::net
@@ -0,0 +1,293 @@
+/**
+ * @file ReplayTransport.cpp
+ * @brief pcapng playback transport implementation
+ */
+
+#ifndef __EMSCRIPTEN__
+
+#include "ReplayTransport.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#include <oc/log/Log.hpp>
+
+#include "PcapNg.hpp"
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace oc::hal::net {
+
+namespace {
+
+uint64_t steadyNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+}  // namespace
+
+ReplayTransport::ReplayTransport() : ReplayTransport(ReplayConfig{}) {}
+
+ReplayTransport::ReplayTransport(const ReplayConfig& config)
+    : config_(config) {}
+
+ReplayTransport::~ReplayTransport() {
+    unmap();
+}
+
+oc::type::Result<void> ReplayTransport::init() {
+    if (data_) {
+        return oc::type::Result<void>::ok();
+    }
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(config_.path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        OC_LOG_ERROR("[Replay] Cannot open {}", config_.path.c_str());
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    fileHandle_ = file;
+    mappingHandle_ = mapping;
+    if (!view) {
+        OC_LOG_ERROR("[Replay] Cannot map {}", config_.path.c_str());
+        unmap();
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+    data_ = static_cast<const uint8_t*>(view);
+    size_ = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(config_.path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        OC_LOG_ERROR("[Replay] Cannot open {}: {}", config_.path.c_str(), errno);
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        OC_LOG_ERROR("[Replay] Empty or unreadable file {}", config_.path.c_str());
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+    void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping keeps the file alive
+    if (view == MAP_FAILED) {
+        OC_LOG_ERROR("[Replay] Cannot map {}: {}", config_.path.c_str(), errno);
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+    madvise(view, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+    data_ = static_cast<const uint8_t*>(view);
+    size_ = static_cast<size_t>(st.st_size);
+#endif
+
+    // Section header: block type, length, byte-order magic
+    if (size_ < 12 || pcapng::get32(data_) != pcapng::kSectionHeaderBlock ||
+        pcapng::get32(data_ + 8) != pcapng::kByteOrderMagic) {
+        OC_LOG_ERROR("[Replay] {} is not a native-endian pcapng file", config_.path.c_str());
+        unmap();
+        return oc::type::Result<void>::err(oc::type::ErrorCode::INVALID_STATE);
+    }
+
+    firstBlock_ = 0;
+    scanInterfaces();
+    rewind();
+    OC_LOG_INFO("[Replay] Loaded {} ({} bytes)", config_.path.c_str(), size_);
+    return oc::type::Result<void>::ok();
+}
+
+void ReplayTransport::update() {
+    if (!data_ || !onReceive_) {
+        return;
+    }
+
+    size_t deliveredNow = 0;
+    bool rewound = false;
+    while (config_.maxFramesPerUpdate == 0 || deliveredNow < config_.maxFramesPerUpdate) {
+        uint64_t timestampNs;
+        const uint8_t* frame;
+        uint32_t length;
+        size_t nextOffset;
+
+        if (!peekFrame(timestampNs, frame, length, nextOffset)) {
+            offset_ = sectionEnd_;
+            if (!config_.loop || delivered_ == 0) {
+                return;
+            }
+            rewind();
+            // End of a pass ends this update(); with speed = 0 and no frame
+            // limit, looping on would never return
+            if (deliveredNow > 0 || rewound) {
+                return;
+            }
+            rewound = true;
+            continue;
+        }
+
+        if (config_.speed > 0.0) {
+            uint64_t now = steadyNs();
+            if (!started_) {
+                started_ = true;
+                firstFrameNs_ = timestampNs;
+                startNs_ = now;
+            }
+            // Frames recorded out of order (rx/tx threads, clock steps) are due at once
+            uint64_t elapsedNs = timestampNs > firstFrameNs_ ? timestampNs - firstFrameNs_ : 0;
+            double due = static_cast<double>(elapsedNs) / config_.speed;
+            if (static_cast<double>(now - startNs_) < due) {
+                return;  // Not due yet
+            }
+        }
+
+        offset_ = nextOffset;
+        currentTimestampNs_ = timestampNs;
+        delivered_++;
+        deliveredNow++;
+        onReceive_(frame, length);
+    }
+}
+
+void ReplayTransport::send(const uint8_t* /*data*/, size_t /*length*/) {
+    sent_++;
+}
+
+void ReplayTransport::setOnReceive(ReceiveCallback cb) {
+    onReceive_ = std::move(cb);
+}
+
+void ReplayTransport::rewind() {
+    offset_ = firstBlock_;
+    started_ = false;
+}
+
+bool ReplayTransport::peekFrame(uint64_t& timestampNs, const uint8_t*& data,
+                                uint32_t& length, size_t& nextOffset) {
+    const uint32_t wanted = config_.direction == CaptureDirection::Rx ? pcapng::kFlagInbound
+                                                                      : pcapng::kFlagOutbound;
+    size_t offset = offset_;
+
+    while (offset + 12 <= sectionEnd_) {
+        const uint8_t* block = data_ + offset;
+        uint32_t type = pcapng::get32(block);
+        uint32_t blockLength = pcapng::get32(block + 4);
+        if (blockLength < 12 || offset + blockLength > sectionEnd_) {
+            OC_LOG_WARN("[Replay] Truncated block at offset {}", offset);
+            return false;
+        }
+        offset += blockLength;
+
+        if (type != pcapng::kEnhancedPacketBlock || blockLength < 32) {
+            continue;  // SHB, IDB, statistics, ...
+        }
+
+        uint32_t captured = pcapng::get32(block + 20);
+        size_t optionsStart = 28 + pcapng::padded(captured);
+        if (optionsStart + 4 > blockLength) {
+            continue;
+        }
+
+        // Direction from epb_flags (frames without flags are always delivered)
+        uint32_t flags = 0;
+        for (size_t opt = optionsStart; opt + 4 <= blockLength - 4;) {
+            uint16_t code;
+            uint16_t optLength;
+            memcpy(&code, block + opt, sizeof(code));
+            memcpy(&optLength, block + opt + 2, sizeof(optLength));
+            if (code == pcapng::kOptEndOfOpt) break;
+            if (code == pcapng::kOptEpbFlags && optLength == 4) {
+                flags = pcapng::get32(block + opt + 4);
+            }
+            opt += 4 + pcapng::padded(optLength);
+        }
+        if (flags != 0 && (flags & pcapng::kFlagDirectionMask) != wanted) {
+            continue;
+        }
+
+        uint32_t interfaceId = pcapng::get32(block + 8);
+        if (interfaceId >= ifTsResol_.size()) {
+            continue;  // No matching IDB, timestamp unit unknown
+        }
+
+        uint64_t ticks = (static_cast<uint64_t>(pcapng::get32(block + 12)) << 32) |
+                         pcapng::get32(block + 16);
+        timestampNs = pcapng::toNanoseconds(ticks, ifTsResol_[interfaceId]);
+        data = block + 28;
+        length = captured;
+        nextOffset = offset;
+        return true;
+    }
+    return false;
+}
+
+void ReplayTransport::scanInterfaces() {
+    ifTsResol_.clear();
+    sectionEnd_ = size_;
+
+    size_t offset = firstBlock_;
+    while (offset + 12 <= size_) {
+        const uint8_t* block = data_ + offset;
+        uint32_t type = pcapng::get32(block);
+        uint32_t blockLength = pcapng::get32(block + 4);
+        if (blockLength < 12 || offset + blockLength > size_) {
+            return;  // peekFrame() reports the truncation
+        }
+
+        if (type == pcapng::kSectionHeaderBlock && offset != firstBlock_) {
+            // Interface ids (and possibly byte order) restart in a new section
+            OC_LOG_WARN("[Replay] Ignoring pcapng sections after offset {}", offset);
+            sectionEnd_ = offset;
+            return;
+        }
+
+        if (type == pcapng::kInterfaceDescriptionBlock && blockLength >= 20) {
+            uint8_t tsresol = pcapng::kDefaultTsResol;
+            for (size_t opt = 16; opt + 4 <= blockLength - 4;) {
+                uint16_t code;
+                uint16_t optLength;
+                memcpy(&code, block + opt, sizeof(code));
+                memcpy(&optLength, block + opt + 2, sizeof(optLength));
+                if (code == pcapng::kOptEndOfOpt) break;
+                if (code == pcapng::kOptIfTsResol && optLength == 1) {
+                    tsresol = block[opt + 4];
+                }
+                opt += 4 + pcapng::padded(optLength);
+            }
+            ifTsResol_.push_back(tsresol);
+        }
+        offset += blockLength;
+    }
+}
+
+void ReplayTransport::unmap() {
+#ifdef _WIN32
+    if (data_) UnmapViewOfFile(data_);
+    if (mappingHandle_) CloseHandle(static_cast<HANDLE>(mappingHandle_));
+    if (fileHandle_) CloseHandle(static_cast<HANDLE>(fileHandle_));
+    mappingHandle_ = nullptr;
+    fileHandle_ = nullptr;
+#else
+    if (data_) munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    sectionEnd_ = 0;
+    offset_ = 0;
+}
+
+}  // namespace oc::hal::net
+
+#endif  // __EMSCRIPTEN__
@@ -0,0 +1,152 @@
+#pragma once
+
+/**
+ * @file ReplayTransport.hpp
+ * @brief ITransport that plays back frames from a pcapng capture
+ *
+ * Memory-maps a file written by CaptureTransport (or any native-endian
+ * pcapng file with Enhanced Packet Blocks) and feeds the selected frames
+ * to the receive callback, either respecting the original inter-frame
+ * timing or as fast as possible. Timestamps are converted using each
+ * interface's if_tsresol. Only the first section of a multi-section file
+ * is played. Frames are delivered straight from the mapping - no copies,
+ * no allocation after init().
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * ReplayConfig config;
+ * config.path = "session.pcapng";
+ * config.speed = 0.0;   // As fast as possible (load test)
+ *
+ * ReplayTransport replay(config);
+ * replay.init();
+ * replay.setOnReceive(handleFrame);
+ *
+ * while (!replay.finished()) {
+ *     replay.update();
+ * }
+ * ```
+ *
+ * ## Platform Notes
+ *
+ * - Native builds only (mmap / MapViewOfFile)
+ */
+
+#ifndef __EMSCRIPTEN__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <oc/type/Result.hpp>
+#include <oc/interface/ITransport.hpp>
+
+#include "CaptureWriter.hpp"
+
+namespace oc::hal::net {
+
+/**
+ * @brief Configuration for ReplayTransport
+ */
+struct ReplayConfig {
+    /// Capture file (pcapng)
+    std::string path = "capture.pcapng";
+
+    /// Which recorded frames to deliver (Rx = what the app received)
+    CaptureDirection direction = CaptureDirection::Rx;
+
+    /// Playback speed: 1.0 = original timing, 2.0 = twice as fast,
+    /// 0 = as fast as possible
+    double speed = 1.0;
+
+    /// Maximum frames delivered per update() (0 = unlimited)
+    size_t maxFramesPerUpdate = 0;
+
+    /// Restart from the beginning when the end is reached. One update()
+    /// stops at the end of the file, so it never delivers more than one
+    /// full pass even with speed = 0 and maxFramesPerUpdate = 0.
+    bool loop = false;
+};
+
+class ReplayTransport : public interface::ITransport {
+public:
+    ReplayTransport();
+    explicit ReplayTransport(const ReplayConfig& config);
+    ~ReplayTransport() override;
+
+    // Non-copyable, non-movable (owns a mapping)
+    ReplayTransport(const ReplayTransport&) = delete;
+    ReplayTransport& operator=(const ReplayTransport&) = delete;
+    ReplayTransport(ReplayTransport&&) = delete;
+    ReplayTransport& operator=(ReplayTransport&&) = delete;
+
+    /**
+     * @brief Map the file and validate the pcapng header
+     *
+     * @return err() if the file is missing or not a native-endian pcapng
+     */
+    oc::type::Result<void> init() override;
+
+    /**
+     * @brief Deliver every frame that is due
+     */
+    void update() override;
+
+    /**
+     * @brief Discards the frame (counted in framesSent())
+     */
+    void send(const uint8_t* data, size_t length) override;
+
+    void setOnReceive(ReceiveCallback cb) override;
+    bool isReady() const override { return data_ != nullptr; }
+
+    /// True once the last frame was delivered (never with loop)
+    bool finished() const { return isReady() && offset_ >= sectionEnd_; }
+
+    /// Restart playback from the first frame
+    void rewind();
+
+    /// Capture timestamp (ns since epoch) of the frame being delivered;
+    /// valid inside the receive callback
+    uint64_t currentTimestampNs() const { return currentTimestampNs_; }
+
+    uint64_t framesDelivered() const { return delivered_; }
+    uint64_t framesSent() const { return sent_; }
+
+private:
+    /// Find the next frame of the configured direction, false at end of file
+    bool peekFrame(uint64_t& timestampNs, const uint8_t*& data, uint32_t& length,
+                   size_t& nextOffset);
+    /// Record if_tsresol of every IDB and where the first section ends
+    void scanInterfaces();
+    void unmap();
+
+    ReplayConfig config_;
+    ReceiveCallback onReceive_;
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    size_t firstBlock_ = 0;
+    size_t sectionEnd_ = 0;
+    size_t offset_ = 0;
+    std::vector<uint8_t> ifTsResol_;  ///< if_tsresol per interface id
+#ifdef _WIN32
+    void* fileHandle_ = nullptr;
+    void* mappingHandle_ = nullptr;
+#endif
+
+    // Playback clock: capture time of the first frame vs. wall time at start
+    bool started_ = false;
+    uint64_t firstFrameNs_ = 0;
+    uint64_t startNs_ = 0;
+    uint64_t currentTimestampNs_ = 0;
+
+    uint64_t delivered_ = 0;
+    uint64_t sent_ = 0;
+};
+
+}  // namespace oc::hal::net
+
+#endif  // __EMSCRIPTEN__
@@ -0,0 +1,214 @@
+#pragma once
+
+/**
+ * @file StaticUdpTransport.hpp
+ * @brief Policy-templated UDP transport with compile-time configuration
+ *
+ * Same wire behaviour as UdpTransport (one datagram = one frame), but
+ * everything except the endpoint is fixed by a policy type at compile
+ * time: the receive buffer is an inline std::array, the per-update batch
+ * size is a constant, and stats/logging compile away when disabled. No
+ * heap allocation, no runtime option checks, no platform headers.
+ *
+ * Socket options only UdpTransport offers (buffer tuning, timestamps,
+ * kernel drop accounting) are intentionally left out; use UdpTransport
+ * when those are needed.
+ *
+ * ## Policy
+ *
+ * ```cpp
+ * struct MyUdpPolicy {
+ *     static constexpr size_t kRecvBufferSize = 512;      // Largest frame
+ *     static constexpr size_t kMaxFramesPerUpdate = 16;   // Batch per update()
+ *     static constexpr bool kStats = false;               // Compile out counters
+ *     static constexpr bool kLogging = false;             // Compile out log calls
+ * };
+ * ```
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * StaticUdpTransport<MyUdpPolicy> transport("127.0.0.1", 9001);
+ * transport.init();
+ *
+ * // In main loop: handler inlined, batch size is a compile-time constant
+ * transport.poll([&](const uint8_t* data, size_t len) {
+ *     parser.feed(data, len);
+ * });
+ * ```
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <oc/log/Log.hpp>
+#include <oc/type/Result.hpp>
+#include <oc/interface/ITransport.hpp>
+
+#include "RateLimitedLog.hpp"
+#include "TransportStats.hpp"
+#include "UdpSocketOps.hpp"
+
+namespace oc::hal::net {
+
+/**
+ * @brief Policy matching UdpTransport's defaults (with batching)
+ */
+struct DefaultUdpPolicy {
+    /// Receive buffer size = largest frame accepted without truncation
+    static constexpr size_t kRecvBufferSize = 4096;
+
+    /// Datagrams drained per update()/poll()
+    static constexpr size_t kMaxFramesPerUpdate = 8;
+
+    /// Keep TransportStats counters
+    static constexpr bool kStats = true;
+
+    /// Emit OC_LOG_* diagnostics
+    static constexpr bool kLogging = true;
+};
+
+/**
+ * @brief UDP transport configured by a compile-time policy
+ *
+ * @tparam Policy Provides kRecvBufferSize, kMaxFramesPerUpdate, kStats
+ *                and kLogging (see DefaultUdpPolicy)
+ */
+template <typename Policy = DefaultUdpPolicy>
+class StaticUdpTransport : public interface::ITransport {
+    static_assert(Policy::kRecvBufferSize > 0, "kRecvBufferSize must be > 0");
+    static_assert(Policy::kMaxFramesPerUpdate > 0, "kMaxFramesPerUpdate must be > 0");
+
+public:
+    static constexpr size_t kRecvBufferSize = Policy::kRecvBufferSize;
+    static constexpr size_t kMaxFramesPerUpdate = Policy::kMaxFramesPerUpdate;
+
+    /**
+     * @param host Destination IPv4 address (dotted literal)
+     * @param port Destination port
+     * @param localPort Local port to bind (0 = ephemeral)
+     */
+    StaticUdpTransport(const char* host, uint16_t port, uint16_t localPort = 0)
+        : localPort_(localPort)
+        , resolved_(detail::udpResolveIpv4(host, port, dest_)) {}
+
+    ~StaticUdpTransport() override { detail::udpClose(socket_); }
+
+    // Non-copyable, non-movable (intended for static / member storage)
+    StaticUdpTransport(const StaticUdpTransport&) = delete;
+    StaticUdpTransport& operator=(const StaticUdpTransport&) = delete;
+    StaticUdpTransport(StaticUdpTransport&&) = delete;
+    StaticUdpTransport& operator=(StaticUdpTransport&&) = delete;
+
+    // ═══════════════════════════════════════════════════════════════════════
+    // IFrameTransport interface
+    // ═══════════════════════════════════════════════════════════════════════
+
+    oc::type::Result<void> init() override {
+        if (socket_ != detail::kInvalidSocket) {
+            return oc::type::Result<void>::ok();
+        }
+        if (!resolved_) {
+            if constexpr (Policy::kLogging) {
+                OC_LOG_ERROR("UDP: Invalid destination address");
+            }
+            return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+        }
+
+        int error = 0;
+        socket_ = detail::udpOpen(localPort_, error);
+        if (socket_ == detail::kInvalidSocket) {
+            if constexpr (Policy::kLogging) {
+                OC_LOG_ERROR("UDP: Failed to open socket on port {} (error {})",
+                             localPort_, error);
+            }
+            return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+        }
+        return oc::type::Result<void>::ok();
+    }
+
+    void update() override {
+        if (onReceive_) {
+            poll(onReceive_);
+        }
+    }
+
+    void send(const uint8_t* data, size_t length) override {
+        if (socket_ == detail::kInvalidSocket || length == 0) {
+            return;
+        }
+        int error = 0;
+        if (detail::udpSendTo(socket_, dest_, data, length, error) < 0) {
+            counters_.onSendError();
+            sendFailedLog_.hit(error);
+        } else {
+            counters_.onSend(length);
+        }
+    }
+
+    void setOnReceive(ReceiveCallback cb) override { onReceive_ = std::move(cb); }
+
+    bool isReady() const override { return socket_ != detail::kInvalidSocket; }
+
+    // ═══════════════════════════════════════════════════════════════════════
+    // Static-path extensions
+    // ═══════════════════════════════════════════════════════════════════════
+
+    /**
+     * @brief Drain up to kMaxFramesPerUpdate datagrams into an inlined handler
+     *
+     * @return Number of frames delivered
+     */
+    template <typename Handler>
+    size_t poll(Handler&& handler) {
+        if (socket_ == detail::kInvalidSocket) {
+            return 0;
+        }
+        if constexpr (Policy::kLogging) {
+            sendFailedLog_.flush([](uint64_t count, int64_t lastError) {
+                OC_LOG_WARN("UDP: Send failed: {} ({}x)", lastError, count);
+            });
+        }
+        size_t count = 0;
+        while (count < kMaxFramesPerUpdate) {
+            bool truncated = false;
+            long received = detail::udpReceive(socket_, recvBuffer_.data(),
+                                               recvBuffer_.size(), truncated);
+            if (received < 0) {
+                break;  // kUdpWouldBlock or error
+            }
+            if (received == 0) {
+                continue;  // Empty datagram: nothing to deliver, keep reading
+            }
+            if (truncated) {
+                counters_.onTruncation();
+            }
+            size_t length = static_cast<size_t>(received);
+            counters_.onReceive(length);
+            handler(static_cast<const uint8_t*>(recvBuffer_.data()), length);
+            count++;
+        }
+        return count;
+    }
+
+    /// Counter snapshot (all zeros when Policy::kStats is false)
+    TransportStats stats() const { return counters_.snapshot(); }
+
+    /// Reset cumulative counters to zero
+    void resetStats() { counters_.reset(); }
+
+private:
+    detail::SocketHandle socket_ = detail::kInvalidSocket;
+    detail::UdpDestination dest_;
+    uint16_t localPort_;
+    bool resolved_;
+
+    ReceiveCallback onReceive_;
+    std::array<uint8_t, kRecvBufferSize> recvBuffer_;
+    TransportCountersFor<Policy::kStats> counters_;
+    RateLimitedLogSiteFor<Policy::kLogging> sendFailedLog_;
+};
+
+}  // namespace oc::hal::net
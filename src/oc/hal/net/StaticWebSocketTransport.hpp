@@ -0,0 +1,327 @@
+#pragma once
+
+/**
+ * @file StaticWebSocketTransport.hpp
+ * @brief Policy-templated WebSocket transport for size-critical WASM builds
+ *
+ * Same behaviour as WebSocketTransport, with every option fixed by a
+ * policy type at compile time. Messages sent while disconnected go into
+ * an inline ring of fixed-size slots (no heap), and reconnection,
+ * buffering, stats and logging are compiled out entirely when disabled.
+ *
+ * ## Policy
+ *
+ * ```cpp
+ * struct MyWsPolicy {
+ *     static constexpr bool kAutoReconnect = true;
+ *     static constexpr uint32_t kReconnectDelayMs = 1000;
+ *     static constexpr uint32_t kReconnectMaxDelayMs = 30000;
+ *     static constexpr size_t kMaxPendingMessages = 16;   // 0 = drop while offline
+ *     static constexpr size_t kMaxPendingMessageSize = 256;
+ *     static constexpr bool kStats = false;
+ *     static constexpr bool kLogging = false;
+ * };
+ * ```
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * static StaticWebSocketTransport<MyWsPolicy> transport("ws://127.0.0.1:9002");
+ * transport.init();
+ * transport.setOnReceive(handleFrame);
+ *
+ * // In main loop
+ * transport.update();  // Handles reconnection timing
+ * ```
+ *
+ * ## Platform Notes
+ *
+ * - Only available on Emscripten builds (__EMSCRIPTEN__ defined)
+ * - Requires linking with -lwebsocket.js
+ */
+
+#ifdef __EMSCRIPTEN__
+
+#include <emscripten/websocket.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include <oc/log/Log.hpp>
+#include <oc/time/Time.hpp>
+#include <oc/type/Result.hpp>
+#include <oc/interface/ITransport.hpp>
+
+#include "RateLimitedLog.hpp"
+#include "TransportStats.hpp"
+
+namespace oc::hal::net {
+
+/**
+ * @brief Policy matching WebSocketTransport's defaults
+ */
+struct DefaultWebSocketPolicy {
+    /// Reconnect automatically with exponential backoff
+    static constexpr bool kAutoReconnect = true;
+
+    /// Initial delay between reconnection attempts (ms)
+    static constexpr uint32_t kReconnectDelayMs = 1000;
+
+    /// Maximum reconnection delay (exponential backoff cap)
+    static constexpr uint32_t kReconnectMaxDelayMs = 30000;
+
+    /// Messages buffered while disconnected (0 = no buffering, drop instead)
+    static constexpr size_t kMaxPendingMessages = 100;
+
+    /// Slot size of the pending ring; larger messages are not buffered
+    static constexpr size_t kMaxPendingMessageSize = 1024;
+
+    /// Keep TransportStats counters
+    static constexpr bool kStats = true;
+
+    /// Emit OC_LOG_* diagnostics
+    static constexpr bool kLogging = true;
+};
+
+/**
+ * @brief WebSocket transport configured by a compile-time policy
+ *
+ * The URL string is not copied and must outlive the transport (typically
+ * a string literal).
+ *
+ * @tparam Policy See DefaultWebSocketPolicy for the required members
+ */
+template <typename Policy = DefaultWebSocketPolicy>
+class StaticWebSocketTransport : public interface::ITransport {
+public:
+    static constexpr bool kBuffering = Policy::kMaxPendingMessages > 0;
+
+    static_assert(!kBuffering || Policy::kMaxPendingMessageSize > 0,
+                  "kMaxPendingMessageSize must be > 0 when buffering");
+
+    explicit StaticWebSocketTransport(const char* url) : url_(url) {}
+
+    ~StaticWebSocketTransport() override {
+        if (socket_ > 0) {
+            emscripten_websocket_close(socket_, 1000, "destructor");
+            emscripten_websocket_delete(socket_);
+            socket_ = 0;
+        }
+    }
+
+    // Non-copyable, non-movable (due to C callback pointers)
+    StaticWebSocketTransport(const StaticWebSocketTransport&) = delete;
+    StaticWebSocketTransport& operator=(const StaticWebSocketTransport&) = delete;
+    StaticWebSocketTransport(StaticWebSocketTransport&&) = delete;
+    StaticWebSocketTransport& operator=(StaticWebSocketTransport&&) = delete;
+
+    // ═══════════════════════════════════════════════════════════════════════
+    // IFrameTransport interface
+    // ═══════════════════════════════════════════════════════════════════════
+
+    oc::type::Result<void> init() override {
+        if (!emscripten_websocket_is_supported()) {
+            if constexpr (Policy::kLogging) {
+                OC_LOG_ERROR("[WebSocket] Not supported in this browser");
+            }
+            return oc::type::Result<void>::err(oc::type::ErrorCode::INVALID_STATE);
+        }
+        connect();
+        return oc::type::Result<void>::ok();
+    }
+
+    void update() override {
+        if constexpr (Policy::kLogging) {
+            sendFailedLog_.flush([](uint64_t count, int64_t lastResult) {
+                OC_LOG_WARN("[WebSocket] Send failed: {} ({}x)", lastResult, count);
+            });
+        }
+        if constexpr (Policy::kAutoReconnect) {
+            if (!connected_ && !connecting_) {
+                uint32_t now = oc::time::millis();
+                if (now - lastAttemptMs_ >= currentDelayMs_) {
+                    counters_.onReconnect();
+                    connect();
+                    lastAttemptMs_ = now;
+                }
+            }
+        }
+    }
+
+    void send(const uint8_t* data, size_t length) override {
+        if (connected_) {
+            sendNow(data, length);
+            return;
+        }
+        if constexpr (kBuffering) {
+            enqueue(data, length);
+        }
+    }
+
+    void setOnReceive(ReceiveCallback cb) override { onReceive_ = std::move(cb); }
+
+    bool isReady() const override { return connected_; }
+
+    /// Counter snapshot (all zeros when Policy::kStats is false)
+    TransportStats stats() const { return counters_.snapshot(); }
+
+    /// Reset cumulative counters to zero
+    void resetStats() { counters_.reset(); }
+
+private:
+    static constexpr size_t kPendingSlots = Policy::kMaxPendingMessages;
+    static constexpr size_t kSlotSize = kBuffering ? Policy::kMaxPendingMessageSize : 0;
+
+    void connect() {
+        if (socket_ > 0) {
+            emscripten_websocket_delete(socket_);
+            socket_ = 0;
+        }
+
+        EmscriptenWebSocketCreateAttributes attr;
+        emscripten_websocket_init_create_attributes(&attr);
+        attr.url = url_;
+        attr.protocols = nullptr;
+        attr.createOnMainThread = EM_TRUE;
+
+        socket_ = emscripten_websocket_new(&attr);
+        if (socket_ <= 0) {
+            if constexpr (Policy::kLogging) {
+                OC_LOG_ERROR("[WebSocket] Failed to create socket");
+            }
+            scheduleReconnect();
+            return;
+        }
+
+        connecting_ = true;
+        emscripten_websocket_set_onopen_callback(socket_, this, onOpen);
+        emscripten_websocket_set_onmessage_callback(socket_, this, onMessage);
+        emscripten_websocket_set_onclose_callback(socket_, this, onClose);
+        emscripten_websocket_set_onerror_callback(socket_, this, onError);
+    }
+
+    void sendNow(const uint8_t* data, size_t length) {
+        EMSCRIPTEN_RESULT result = emscripten_websocket_send_binary(
+            socket_, const_cast<void*>(static_cast<const void*>(data)),
+            static_cast<uint32_t>(length));
+        if (result != EMSCRIPTEN_RESULT_SUCCESS) {
+            counters_.onSendError();
+            sendFailedLog_.hit(result);
+        } else {
+            counters_.onSend(length);
+        }
+    }
+
+    void enqueue(const uint8_t* data, size_t length) {
+        if (length > kSlotSize) {
+            counters_.onSendError();
+            if constexpr (Policy::kLogging) {
+                OC_LOG_WARN("[WebSocket] Message too large to buffer ({} bytes)", length);
+            }
+            return;
+        }
+        if (pendingCount_ == kPendingSlots) {
+            // Drop oldest message to make room
+            pendingHead_ = (pendingHead_ + 1) % kPendingSlots;
+            pendingCount_--;
+            counters_.onDroppedOldest();
+        }
+        size_t slot = (pendingHead_ + pendingCount_) % kPendingSlots;
+        memcpy(&pendingData_[slot * kSlotSize], data, length);
+        pendingLengths_[slot] = length;
+        pendingCount_++;
+        counters_.setBufferedFrames(pendingCount_);
+    }
+
+    void flushPendingMessages() {
+        if constexpr (kBuffering) {
+            while (pendingCount_ > 0) {
+                size_t slot = pendingHead_;
+                sendNow(&pendingData_[slot * kSlotSize], pendingLengths_[slot]);
+                pendingHead_ = (pendingHead_ + 1) % kPendingSlots;
+                pendingCount_--;
+            }
+            counters_.setBufferedFrames(0);
+        }
+    }
+
+    void scheduleReconnect() {
+        connecting_ = false;
+        if constexpr (Policy::kAutoReconnect) {
+            currentDelayMs_ = std::min(currentDelayMs_ * 2, Policy::kReconnectMaxDelayMs);
+            lastAttemptMs_ = oc::time::millis();
+        }
+    }
+
+    // ═══════════════════════════════════════════════════════════════════════
+    // Static Emscripten Callbacks
+    // ═══════════════════════════════════════════════════════════════════════
+
+    static EM_BOOL onOpen(int, const EmscriptenWebSocketOpenEvent*, void* userData) {
+        auto* self = static_cast<StaticWebSocketTransport*>(userData);
+        if constexpr (Policy::kLogging) {
+            OC_LOG_INFO("[WebSocket] Connected to {}", self->url_);
+        }
+        self->connected_ = true;
+        self->connecting_ = false;
+        self->currentDelayMs_ = Policy::kReconnectDelayMs;
+        self->flushPendingMessages();
+        return EM_TRUE;
+    }
+
+    static EM_BOOL onMessage(int, const EmscriptenWebSocketMessageEvent* event, void* userData) {
+        auto* self = static_cast<StaticWebSocketTransport*>(userData);
+        if (!event->isText && self->onReceive_) {
+            self->counters_.onReceive(static_cast<size_t>(event->numBytes));
+            self->onReceive_(event->data, static_cast<size_t>(event->numBytes));
+        }
+        return EM_TRUE;
+    }
+
+    static EM_BOOL onClose(int, const EmscriptenWebSocketCloseEvent* event, void* userData) {
+        auto* self = static_cast<StaticWebSocketTransport*>(userData);
+        if constexpr (Policy::kLogging) {
+            OC_LOG_WARN("[WebSocket] Closed (code={})", event->code);
+        } else {
+            (void)event;
+        }
+        self->connected_ = false;
+        self->scheduleReconnect();
+        return EM_TRUE;
+    }
+
+    static EM_BOOL onError(int, const EmscriptenWebSocketErrorEvent*, void*) {
+        if constexpr (Policy::kLogging) {
+            OC_LOG_ERROR("[WebSocket] Error occurred");
+        }
+        // onClose follows
+        return EM_TRUE;
+    }
+
+    const char* url_;
+    EMSCRIPTEN_WEBSOCKET_T socket_ = 0;
+    bool connected_ = false;
+    bool connecting_ = false;
+
+    ReceiveCallback onReceive_;
+
+    // Pending ring: kPendingSlots fixed-size slots, oldest at pendingHead_
+    std::array<uint8_t, kPendingSlots * kSlotSize> pendingData_{};
+    std::array<size_t, kPendingSlots> pendingLengths_{};
+    size_t pendingHead_ = 0;
+    size_t pendingCount_ = 0;
+
+    uint32_t lastAttemptMs_ = 0;
+    uint32_t currentDelayMs_ = Policy::kReconnectDelayMs;
+
+    TransportCountersFor<Policy::kStats> counters_;
+    RateLimitedLogSiteFor<Policy::kLogging> sendFailedLog_;
+};
+
+}  // namespace oc::hal::net
+
+#endif  // __EMSCRIPTEN__
@@ -0,0 +1,184 @@
+/**
+ * @file ThreadOptions.cpp
+ * @brief Per-platform thread naming, affinity and priority
+ */
+
+#ifndef __EMSCRIPTEN__
+
+#include "ThreadOptions.hpp"
+
+#include <oc/log/Log.hpp>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <errno.h>
+    #include <pthread.h>
+    #include <sched.h>
+    #ifdef __linux__
+        #include <sys/resource.h>
+        #include <sys/syscall.h>
+        #include <unistd.h>
+    #endif
+#endif
+
+namespace oc::hal::net {
+
+namespace {
+
+bool applyName(const std::string& name) {
+#if defined(__linux__)
+    // Linux limit: 16 bytes including the terminator
+    int error = pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#elif defined(__APPLE__)
+    int error = pthread_setname_np(name.c_str());
+#elif defined(_WIN32)
+    // SetThreadDescription is Windows 10 1607+; look it up instead of linking it
+    using SetDescription = HRESULT(WINAPI*)(HANDLE, PCWSTR);
+    auto setDescription = reinterpret_cast<SetDescription>(reinterpret_cast<void*>(
+        GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "SetThreadDescription")));
+    if (!setDescription) {
+        OC_LOG_WARN("[Thread] Naming not supported on this Windows version");
+        return false;
+    }
+    std::wstring wide(name.size(), L'\0');
+    int length = MultiByteToWideChar(CP_UTF8, 0, name.data(), static_cast<int>(name.size()),
+                                     wide.data(), static_cast<int>(wide.size()));
+    wide.resize(static_cast<size_t>(length > 0 ? length : 0));
+    int error = FAILED(setDescription(GetCurrentThread(), wide.c_str())) ? 1 : 0;
+#else
+    int error = -1;
+#endif
+    if (error != 0) {
+        OC_LOG_WARN("[Thread] Cannot name thread {}: {}", name.c_str(), error);
+        return false;
+    }
+    return true;
+}
+
+bool applyAffinity(const std::vector<int>& cpus) {
+#if defined(__linux__)
+    bool valid = true;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        if (cpu < 0 || cpu >= CPU_SETSIZE) {
+            OC_LOG_WARN("[Thread] Ignoring invalid CPU {}", cpu);
+            valid = false;
+            continue;
+        }
+        CPU_SET(cpu, &set);
+    }
+    if (CPU_COUNT(&set) == 0) {
+        return false;
+    }
+    int error = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (error != 0) {
+        OC_LOG_WARN("[Thread] CPU affinity failed: {}", error);
+        return false;
+    }
+    return valid;
+#elif defined(_WIN32)
+    bool valid = true;
+    DWORD_PTR mask = 0;
+    for (int cpu : cpus) {
+        if (cpu < 0 || cpu >= static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+            OC_LOG_WARN("[Thread] Ignoring CPU {} (outside the default processor group)", cpu);
+            valid = false;
+            continue;
+        }
+        mask |= DWORD_PTR{1} << cpu;
+    }
+    if (mask == 0) {
+        return false;
+    }
+    if (SetThreadAffinityMask(GetCurrentThread(), mask) == 0) {
+        OC_LOG_WARN("[Thread] CPU affinity failed: {}", GetLastError());
+        return false;
+    }
+    return valid;
+#else
+    (void)cpus;
+    OC_LOG_WARN("[Thread] CPU affinity not supported on this platform");
+    return false;
+#endif
+}
+
+bool applyRealtime(int priority) {
+#ifdef _WIN32
+    (void)priority;  // Windows has no per-thread real-time policy; use its top level
+    if (!SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL)) {
+        OC_LOG_WARN("[Thread] Time-critical priority failed: {}", GetLastError());
+        return false;
+    }
+    return true;
+#else
+    struct sched_param param{};
+    param.sched_priority = priority;
+    int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (error != 0) {
+        // EPERM without CAP_SYS_NICE or an RLIMIT_RTPRIO allowance
+        OC_LOG_WARN("[Thread] SCHED_FIFO {} failed: {}", priority, error);
+        return false;
+    }
+    return true;
+#endif
+}
+
+bool applyNice(int nice) {
+#if defined(__linux__)
+    // On Linux nice is per thread when addressed by thread id
+    pid_t tid = static_cast<pid_t>(syscall(SYS_gettid));
+    if (setpriority(PRIO_PROCESS, static_cast<id_t>(tid), nice) != 0) {
+        // EACCES: lowering nice needs CAP_SYS_NICE or RLIMIT_NICE
+        OC_LOG_WARN("[Thread] nice {} failed: {}", nice, errno);
+        return false;
+    }
+    return true;
+#elif defined(_WIN32)
+    int level = nice <= -15 ? THREAD_PRIORITY_HIGHEST
+              : nice < 0    ? THREAD_PRIORITY_ABOVE_NORMAL
+              : nice < 10   ? THREAD_PRIORITY_BELOW_NORMAL
+                            : THREAD_PRIORITY_LOWEST;
+    if (!SetThreadPriority(GetCurrentThread(), level)) {
+        OC_LOG_WARN("[Thread] Thread priority failed: {}", GetLastError());
+        return false;
+    }
+    return true;
+#else
+    // setpriority() would renice the whole process here
+    OC_LOG_WARN("[Thread] Per-thread nice {} not supported on this platform", nice);
+    return false;
+#endif
+}
+
+}  // namespace
+
+bool applyThreadOptions(const ThreadOptions& options) {
+    bool ok = true;
+
+    if (!options.name.empty()) {
+        ok = applyName(options.name) && ok;
+    }
+    if (!options.cpuAffinity.empty()) {
+        ok = applyAffinity(options.cpuAffinity) && ok;
+    }
+
+    bool realtime = false;
+    if (options.realtimePriority > 0) {
+        realtime = applyRealtime(options.realtimePriority);
+        ok = realtime && ok;
+    }
+    // nice has no effect under SCHED_FIFO; it is the fallback when that was refused
+    if (options.nice != 0 && !realtime) {
+        ok = applyNice(options.nice) && ok;
+    }
+    return ok;
+}
+
+}  // namespace oc::hal::net
+
+#endif  // __EMSCRIPTEN__
@@ -0,0 +1,88 @@
+#pragma once
+
+/**
+ * @file ThreadOptions.hpp
+ * @brief Name, CPU affinity and scheduling priority for transport threads
+ *
+ * A background thread that migrates between cores or is preempted by UI
+ * rendering adds milliseconds of jitter. ThreadOptions describes where and
+ * how such a thread should run; applyThreadOptions() applies it to the
+ * calling thread. Background threads of this library (CaptureWriter,
+ * AddressResolver) take a ThreadOptions in their config and apply it when
+ * they start; an application receive thread (UdpTransport::waitAndUpdate())
+ * calls applyThreadOptions() itself.
+ *
+ * Every setting is best effort: real-time priority and negative nice
+ * values usually need privileges (CAP_SYS_NICE, RLIMIT_RTPRIO), and some
+ * platforms lack affinity. A setting that cannot be applied is logged and
+ * skipped; the thread keeps running with the OS defaults for it.
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * ThreadOptions rx;
+ * rx.name = "oc-udp-rx";
+ * rx.cpuAffinity = {3};
+ * rx.realtimePriority = 50;  // SCHED_FIFO, falls back to nice
+ * rx.nice = -10;
+ *
+ * std::thread receiver([&] {
+ *     applyThreadOptions(rx);
+ *     while (running) transport.waitAndUpdate(100);
+ * });
+ * ```
+ *
+ * ## Platform Notes
+ *
+ * - Linux: all settings (name truncated to 15 characters)
+ * - macOS: name and SCHED_FIFO; affinity and per-thread nice are unsupported
+ * - Windows: name (Windows 10 1607+), affinity for CPUs 0-63, and
+ *   realtimePriority / nice mapped to thread priority levels
+ * - Native builds only
+ */
+
+#ifndef __EMSCRIPTEN__
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace oc::hal::net {
+
+/**
+ * @brief Placement and priority of one thread
+ *
+ * Defaults leave everything as the OS set it.
+ */
+struct ThreadOptions {
+    ThreadOptions() = default;
+
+    /// Named thread, everything else left as the OS set it
+    explicit ThreadOptions(std::string threadName) : name(std::move(threadName)) {}
+
+    /// Name shown in top, gdb and profilers (empty = unchanged)
+    std::string name;
+
+    /// CPUs the thread may run on (empty = any)
+    std::vector<int> cpuAffinity;
+
+    /// SCHED_FIFO priority 1-99 (0 = normal time-sharing scheduling).
+    /// If refused, nice is applied instead.
+    int realtimePriority = 0;
+
+    /// Time-sharing nice value, -20 (favored) to 19 (0 = unchanged)
+    int nice = 0;
+};
+
+/**
+ * @brief Apply options to the calling thread
+ *
+ * Failures are logged as warnings and do not stop the remaining settings.
+ *
+ * @return true if every requested setting took effect
+ */
+bool applyThreadOptions(const ThreadOptions& options);
+
+}  // namespace oc::hal::net
+
+#endif  // __EMSCRIPTEN__
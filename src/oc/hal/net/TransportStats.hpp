@@ -0,0 +1,184 @@
+#pragma once
+
+/**
+ * @file TransportStats.hpp
+ * @brief Per-instance transport counters and snapshot type
+ *
+ * Every transport in oc::hal::net keeps a TransportCounters instance and
+ * exposes a TransportStats snapshot via stats(). Counters are relaxed
+ * atomics: updating them costs one uncontended add on the hot path, and
+ * a snapshot can be taken from any thread (e.g. a diagnostics overlay).
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * TransportStats s = transport.stats();
+ * OC_LOG_INFO("rx={} tx={} sendErrors={}", s.rxFrames, s.txFrames, s.sendErrors);
+ * ```
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace oc::hal::net {
+
+/**
+ * @brief Point-in-time snapshot of transport counters
+ *
+ * All counters are cumulative since construction (or resetStats()),
+ * except bufferedFrames which is the current queue depth.
+ */
+struct TransportStats {
+    /// Frames delivered to the receive callback
+    uint64_t rxFrames = 0;
+
+    /// Payload bytes delivered to the receive callback
+    uint64_t rxBytes = 0;
+
+    /// Frames handed to the OS / browser for sending
+    uint64_t txFrames = 0;
+
+    /// Payload bytes handed to the OS / browser for sending
+    uint64_t txBytes = 0;
+
+    /// send() calls that failed at the OS / browser level
+    uint64_t sendErrors = 0;
+
+    /// Received frames larger than the receive buffer (payload cut off)
+    uint64_t truncations = 0;
+
+    /// Frames dropped by the OS before reaching the transport
+    /// (socket receive buffer overflow; Linux UDP only, 0 elsewhere)
+    uint64_t kernelDrops = 0;
+
+    /// Frames currently queued inside the transport, waiting to be sent
+    uint64_t bufferedFrames = 0;
+
+    /// Queued frames discarded to make room for newer ones
+    uint64_t droppedOldest = 0;
+
+    /// Reconnection attempts
+    uint64_t reconnects = 0;
+};
+
+/**
+ * @brief Live counters backing TransportStats
+ *
+ * Intended as a member of a transport. Counters may be updated from
+ * several threads (e.g. concurrent send() calls) and reset or snapshotted
+ * from anywhere. Copy/move transfers the current values so that
+ * transports stay movable.
+ */
+class TransportCounters {
+public:
+    TransportCounters() = default;
+
+    TransportCounters(const TransportCounters& other) { load(other.snapshot()); }
+
+    TransportCounters& operator=(const TransportCounters& other) {
+        if (this != &other) {
+            load(other.snapshot());
+        }
+        return *this;
+    }
+
+    void onReceive(size_t length) {
+        add(rxFrames_, 1);
+        add(rxBytes_, length);
+    }
+
+    void onSend(size_t length) {
+        add(txFrames_, 1);
+        add(txBytes_, length);
+    }
+
+    void onSendError() { add(sendErrors_, 1); }
+    void onTruncation() { add(truncations_, 1); }
+    void onKernelDrops(uint64_t count) { add(kernelDrops_, count); }
+    void onDroppedOldest() { add(droppedOldest_, 1); }
+    void onReconnect() { add(reconnects_, 1); }
+
+    void setBufferedFrames(size_t count) {
+        bufferedFrames_.store(count, std::memory_order_relaxed);
+    }
+
+    TransportStats snapshot() const {
+        TransportStats s;
+        s.rxFrames = rxFrames_.load(std::memory_order_relaxed);
+        s.rxBytes = rxBytes_.load(std::memory_order_relaxed);
+        s.txFrames = txFrames_.load(std::memory_order_relaxed);
+        s.txBytes = txBytes_.load(std::memory_order_relaxed);
+        s.sendErrors = sendErrors_.load(std::memory_order_relaxed);
+        s.truncations = truncations_.load(std::memory_order_relaxed);
+        s.kernelDrops = kernelDrops_.load(std::memory_order_relaxed);
+        s.bufferedFrames = bufferedFrames_.load(std::memory_order_relaxed);
+        s.droppedOldest = droppedOldest_.load(std::memory_order_relaxed);
+        s.reconnects = reconnects_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    /// Reset cumulative counters (bufferedFrames is a gauge and is kept)
+    void reset() {
+        TransportStats s;
+        s.bufferedFrames = bufferedFrames_.load(std::memory_order_relaxed);
+        load(s);
+    }
+
+private:
+    static void add(std::atomic<uint64_t>& counter, uint64_t n) {
+        counter.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    void load(const TransportStats& s) {
+        rxFrames_.store(s.rxFrames, std::memory_order_relaxed);
+        rxBytes_.store(s.rxBytes, std::memory_order_relaxed);
+        txFrames_.store(s.txFrames, std::memory_order_relaxed);
+        txBytes_.store(s.txBytes, std::memory_order_relaxed);
+        sendErrors_.store(s.sendErrors, std::memory_order_relaxed);
+        truncations_.store(s.truncations, std::memory_order_relaxed);
+        kernelDrops_.store(s.kernelDrops, std::memory_order_relaxed);
+        bufferedFrames_.store(s.bufferedFrames, std::memory_order_relaxed);
+        droppedOldest_.store(s.droppedOldest, std::memory_order_relaxed);
+        reconnects_.store(s.reconnects, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> rxFrames_{0};
+    std::atomic<uint64_t> rxBytes_{0};
+    std::atomic<uint64_t> txFrames_{0};
+    std::atomic<uint64_t> txBytes_{0};
+    std::atomic<uint64_t> sendErrors_{0};
+    std::atomic<uint64_t> truncations_{0};
+    std::atomic<uint64_t> kernelDrops_{0};
+    std::atomic<uint64_t> bufferedFrames_{0};
+    std::atomic<uint64_t> droppedOldest_{0};
+    std::atomic<uint64_t> reconnects_{0};
+};
+
+/**
+ * @brief Drop-in TransportCounters replacement that records nothing
+ *
+ * Used by the policy-templated transports when stats are compiled out;
+ * every call inlines to nothing and snapshot() is all zeros.
+ */
+class NullTransportCounters {
+public:
+    void onReceive(size_t) {}
+    void onSend(size_t) {}
+    void onSendError() {}
+    void onTruncation() {}
+    void onKernelDrops(uint64_t) {}
+    void onDroppedOldest() {}
+    void onReconnect() {}
+    void setBufferedFrames(size_t) {}
+    TransportStats snapshot() const { return {}; }
+    void reset() {}
+};
+
+/// TransportCounters if Enabled, NullTransportCounters otherwise
+template <bool Enabled>
+using TransportCountersFor =
+    std::conditional_t<Enabled, TransportCounters, NullTransportCounters>;
+
+}  // namespace oc::hal::net
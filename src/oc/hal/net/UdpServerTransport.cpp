@@ -0,0 +1,568 @@
+#include "UdpServerTransport.hpp"
+
+#include <algorithm>
+
+#include <oc/log/Log.hpp>
+#include <oc/time/Time.hpp>
+
+#ifdef _WIN32
+    #pragma comment(lib, "ws2_32.lib")
+#else
+    #include <errno.h>
+#endif
+
+namespace oc::hal::net {
+
+namespace {
+
+constexpr size_t kMaxPeers = 0xFFFF;  // PeerId = generation << 16 | (index + 1)
+
+int lastSocketError() {
+#ifdef _WIN32
+    return WSAGetLastError();
+#else
+    return errno;
+#endif
+}
+
+}  // namespace
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Construction / Destruction
+// ═══════════════════════════════════════════════════════════════════════════
+
+UdpServerTransport::UdpServerTransport() : UdpServerTransport(UdpServerConfig{}) {}
+
+UdpServerTransport::UdpServerTransport(const UdpServerConfig& config)
+    : config_(config)
+    , pool_(config.memoryResource ? config.memoryResource : std::pmr::get_default_resource())
+    , freeList_(pool_.get_allocator())
+    , slots_(pool_.get_allocator())
+    , recvBuffer_(pool_.get_allocator())
+    , sendFailedLog_(config.logIntervalMs)
+    , tableFullLog_(config.logIntervalMs) {
+    config_.maxPeers = std::min(std::max<size_t>(config_.maxPeers, 1), kMaxPeers);
+
+    // Load factor <= 1/2 keeps probe sequences short
+    size_t slotCount = 1;
+    while (slotCount < config_.maxPeers * 2) {
+        slotCount <<= 1;
+    }
+    pool_.resize(config_.maxPeers);
+    slots_.assign(slotCount, Slot{0, 0});
+    slotMask_ = slotCount - 1;
+    freeList_.reserve(config_.maxPeers);
+    for (size_t i = config_.maxPeers; i > 0; --i) {
+        freeList_.push_back(static_cast<uint32_t>(i - 1));
+    }
+    recvBuffer_.resize(config_.recvBufferSize);
+}
+
+UdpServerTransport::~UdpServerTransport() {
+    cleanup();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ITransport interface
+// ═══════════════════════════════════════════════════════════════════════════
+
+oc::type::Result<void> UdpServerTransport::init() {
+    if (initialized_) {
+        return oc::type::Result<void>::ok();
+    }
+
+#ifdef _WIN32
+    // Reference counted by Winsock; balanced in cleanup()
+    WSADATA wsaData;
+    int wsaResult = WSAStartup(MAKEWORD(2, 2), &wsaData);
+    if (wsaResult != 0) {
+        OC_LOG_ERROR("UDP: WSAStartup failed: {}", wsaResult);
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+    winsockStarted_ = true;
+#endif
+
+    // Dual-stack IPv6 unless restricted, IPv4 as fallback
+    int family = 0;
+    if (config_.addressFamily != UdpAddressFamily::IPv4) {
+        socket_ = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+#ifdef _WIN32
+        bool valid = socket_ != INVALID_SOCKET;
+#else
+        bool valid = socket_ >= 0;
+#endif
+        if (valid) {
+            int v6only = config_.addressFamily == UdpAddressFamily::IPv6 ? 1 : 0;
+            if (setsockopt(socket_, IPPROTO_IPV6, IPV6_V6ONLY,
+                           reinterpret_cast<const char*>(&v6only), sizeof(v6only)) == 0 ||
+                v6only == 1) {
+                family = AF_INET6;
+            } else {
+                closeSocket();  // No dual-stack: fall back to IPv4
+            }
+        }
+    }
+    if (family == 0 && config_.addressFamily != UdpAddressFamily::IPv6) {
+        socket_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+#ifdef _WIN32
+        family = socket_ != INVALID_SOCKET ? AF_INET : 0;
+#else
+        family = socket_ >= 0 ? AF_INET : 0;
+#endif
+    }
+    if (family == 0) {
+        OC_LOG_ERROR("UDP: Failed to create server socket: {}", lastSocketError());
+        cleanup();
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+
+#ifdef _WIN32
+    u_long nonBlocking = 1;
+    bool nonBlockingOk = ioctlsocket(socket_, FIONBIO, &nonBlocking) == 0;
+#else
+    int flags = fcntl(socket_, F_GETFL, 0);
+    bool nonBlockingOk = flags >= 0 && fcntl(socket_, F_SETFL, flags | O_NONBLOCK) == 0;
+#endif
+    if (!nonBlockingOk) {
+        OC_LOG_ERROR("UDP: Failed to set non-blocking: {}", lastSocketError());
+        cleanup();
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+
+    struct sockaddr_storage localAddr;
+    memset(&localAddr, 0, sizeof(localAddr));
+    socklen_t localAddrLen;
+    if (family == AF_INET6) {
+        auto* local6 = reinterpret_cast<struct sockaddr_in6*>(&localAddr);
+        local6->sin6_family = AF_INET6;
+        local6->sin6_addr = in6addr_any;
+        local6->sin6_port = htons(config_.port);
+        localAddrLen = sizeof(struct sockaddr_in6);
+    } else {
+        auto* local4 = reinterpret_cast<struct sockaddr_in*>(&localAddr);
+        local4->sin_family = AF_INET;
+        local4->sin_addr.s_addr = INADDR_ANY;
+        local4->sin_port = htons(config_.port);
+        localAddrLen = sizeof(struct sockaddr_in);
+    }
+    if (bind(socket_, reinterpret_cast<struct sockaddr*>(&localAddr), localAddrLen) < 0) {
+        OC_LOG_ERROR("UDP: Bind to port {} failed: {}", config_.port, lastSocketError());
+        cleanup();
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+
+    initialized_ = true;
+    nowMs_ = oc::time::millis();
+    lastSweepMs_ = nowMs_;
+    OC_LOG_INFO("UDP: Server listening on port {} (max {} peers)", localPort(),
+                config_.maxPeers);
+    return oc::type::Result<void>::ok();
+}
+
+void UdpServerTransport::update() {
+    if (!beginPoll()) {
+        return;
+    }
+    if (!onReceive_ && !onPeerReceive_) {
+        return;
+    }
+
+    PeerId peer;
+    size_t length;
+    for (size_t i = 0; i < config_.maxFramesPerUpdate && receiveNext(peer, length); ++i) {
+        if (onPeerReceive_) {
+            onPeerReceive_(peer, recvBuffer_.data(), length);
+        } else {
+            onReceive_(recvBuffer_.data(), length);
+        }
+    }
+}
+
+void UdpServerTransport::send(const uint8_t* data, size_t length) {
+    broadcast(data, length);
+}
+
+void UdpServerTransport::setOnReceive(ReceiveCallback cb) {
+    onReceive_ = std::move(cb);
+}
+
+bool UdpServerTransport::isReady() const {
+    return initialized_;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Server API
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UdpServerTransport::setOnPeerReceive(PeerReceiveCallback cb) {
+    onPeerReceive_ = std::move(cb);
+}
+
+void UdpServerTransport::setOnPeerJoined(PeerEventCallback cb) {
+    onPeerJoined_ = std::move(cb);
+}
+
+void UdpServerTransport::setOnPeerLeft(PeerEventCallback cb) {
+    onPeerLeft_ = std::move(cb);
+}
+
+bool UdpServerTransport::sendTo(PeerId peer, const uint8_t* data, size_t length) {
+    int index = indexOf(peer);
+    if (index < 0 || !initialized_) {
+        return false;
+    }
+    return sendToIndex(static_cast<size_t>(index), data, length);
+}
+
+size_t UdpServerTransport::broadcast(const uint8_t* data, size_t length) {
+    if (!initialized_ || peerCount_ == 0) {
+        return 0;
+    }
+    size_t sent = 0;
+    for (size_t i = 0; i < pool_.size(); ++i) {
+        if (pool_[i].active && sendToIndex(i, data, length)) {
+            sent++;
+        }
+    }
+    return sent;
+}
+
+bool UdpServerTransport::removePeer(PeerId peer) {
+    int index = indexOf(peer);
+    if (index < 0) {
+        return false;
+    }
+    release(static_cast<size_t>(index));
+    if (onPeerLeft_) {
+        onPeerLeft_(peer);
+    }
+    return true;
+}
+
+bool UdpServerTransport::hasPeer(PeerId peer) const {
+    return indexOf(peer) >= 0;
+}
+
+std::vector<PeerId> UdpServerTransport::peers() const {
+    std::vector<PeerId> ids;
+    ids.reserve(peerCount_);
+    for (size_t i = 0; i < pool_.size(); ++i) {
+        if (pool_[i].active) {
+            ids.push_back(idOf(i));
+        }
+    }
+    return ids;
+}
+
+bool UdpServerTransport::peerInfo(PeerId peer, UdpPeerInfo& out) const {
+    int index = indexOf(peer);
+    if (index < 0) {
+        return false;
+    }
+    const Peer& p = pool_[static_cast<size_t>(index)];
+
+    char text[INET6_ADDRSTRLEN] = {};
+    static const uint8_t kMappedPrefix[12] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF};
+    if (memcmp(p.key.addr, kMappedPrefix, sizeof(kMappedPrefix)) == 0) {
+        inet_ntop(AF_INET, &p.key.addr[12], text, sizeof(text));
+    } else {
+        inet_ntop(AF_INET6, p.key.addr, text, sizeof(text));
+    }
+    out.address = text;
+    out.port = ntohs(p.key.port);
+    out.idleMs = oc::time::millis() - p.lastSeenMs;
+    out.rxFrames = p.rxFrames;
+    out.txFrames = p.txFrames;
+    return true;
+}
+
+uint16_t UdpServerTransport::localPort() const {
+    if (!initialized_) {
+        return 0;
+    }
+    struct sockaddr_storage localAddr;
+    socklen_t addrLen = sizeof(localAddr);
+    if (getsockname(socket_, reinterpret_cast<struct sockaddr*>(&localAddr), &addrLen) != 0) {
+        return 0;
+    }
+    if (localAddr.ss_family == AF_INET6) {
+        return ntohs(reinterpret_cast<const struct sockaddr_in6*>(&localAddr)->sin6_port);
+    }
+    return ntohs(reinterpret_cast<const struct sockaddr_in*>(&localAddr)->sin_port);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Receive Path
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool UdpServerTransport::beginPoll() {
+    if (!initialized_) {
+        return false;
+    }
+    nowMs_ = oc::time::millis();
+
+    // A full sweep is O(maxPeers); a quarter of the timeout is precise enough
+    if (config_.peerIdleTimeoutMs > 0 &&
+        nowMs_ - lastSweepMs_ >= std::max<uint32_t>(config_.peerIdleTimeoutMs / 4, 1)) {
+        lastSweepMs_ = nowMs_;
+        evictIdlePeers();
+    }
+
+    sendFailedLog_.flush([](uint64_t count, int64_t lastError) {
+        OC_LOG_WARN("UDP: Server send failed: {} ({}x)", lastError, count);
+    });
+    tableFullLog_.flush([this](uint64_t count, int64_t) {
+        OC_LOG_WARN("UDP: Peer table full ({} peers), dropped {} datagrams",
+                    config_.maxPeers, count);
+    });
+    return true;
+}
+
+bool UdpServerTransport::receiveNext(PeerId& peer, size_t& length) {
+    struct sockaddr_storage senderAddr;
+    for (;;) {
+#ifdef _WIN32
+        int addrLen = sizeof(senderAddr);
+        int bytesReceived = recvfrom(socket_, reinterpret_cast<char*>(recvBuffer_.data()),
+                                     static_cast<int>(recvBuffer_.size()), 0,
+                                     reinterpret_cast<struct sockaddr*>(&senderAddr), &addrLen);
+        bool truncated = false;
+        if (bytesReceived < 0 && WSAGetLastError() == WSAEMSGSIZE) {
+            // Winsock discards the oversized datagram
+            counters_.onTruncation();
+            continue;
+        }
+#else
+        struct iovec iov;
+        iov.iov_base = recvBuffer_.data();
+        iov.iov_len = recvBuffer_.size();
+
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name = &senderAddr;
+        msg.msg_namelen = sizeof(senderAddr);
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+
+        ssize_t bytesReceived = recvmsg(socket_, &msg, 0);
+        socklen_t addrLen = msg.msg_namelen;
+        bool truncated = (msg.msg_flags & MSG_TRUNC) != 0;
+#endif
+        if (bytesReceived < 0) {
+            // EAGAIN/EWOULDBLOCK is expected for non-blocking sockets with no data
+            return false;
+        }
+        if (bytesReceived == 0) {
+            continue;  // Empty datagram: nothing to deliver
+        }
+
+        peer = lookupOrInsert(senderAddr, static_cast<socklen_t>(addrLen));
+        if (peer == kInvalidPeer) {
+            rejectedDatagrams_++;
+            tableFullLog_.hit();
+            continue;
+        }
+        if (truncated) {
+            counters_.onTruncation();
+        }
+        length = static_cast<size_t>(bytesReceived);
+        counters_.onReceive(length);
+        pool_[(peer & 0xFFFF) - 1].rxFrames++;
+        return true;
+    }
+}
+
+bool UdpServerTransport::sendToIndex(size_t index, const uint8_t* data, size_t length) {
+    Peer& p = pool_[index];
+#ifdef _WIN32
+    int bytesSent = sendto(socket_, reinterpret_cast<const char*>(data),
+                           static_cast<int>(length), 0,
+                           reinterpret_cast<const struct sockaddr*>(&p.addr), p.addrLen);
+#else
+    ssize_t bytesSent = sendto(socket_, data, length, 0,
+                               reinterpret_cast<const struct sockaddr*>(&p.addr), p.addrLen);
+#endif
+    if (bytesSent < 0) {
+        counters_.onSendError();
+        sendFailedLog_.hit(lastSocketError());
+        return false;
+    }
+    counters_.onSend(static_cast<size_t>(bytesSent));
+    p.txFrames++;
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Peer Table
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool UdpServerTransport::PeerKey::operator==(const PeerKey& other) const {
+    return memcmp(addr, other.addr, sizeof(addr)) == 0 && scopeId == other.scopeId &&
+           port == other.port;
+}
+
+UdpServerTransport::PeerKey UdpServerTransport::makeKey(const struct sockaddr_storage& addr) {
+    PeerKey key;
+    memset(&key, 0, sizeof(key));
+    if (addr.ss_family == AF_INET6) {
+        const auto* v6 = reinterpret_cast<const struct sockaddr_in6*>(&addr);
+        memcpy(key.addr, &v6->sin6_addr, sizeof(key.addr));
+        key.scopeId = v6->sin6_scope_id;
+        key.port = v6->sin6_port;
+    } else {
+        // Same key as the v4-mapped form a dual-stack socket reports
+        const auto* v4 = reinterpret_cast<const struct sockaddr_in*>(&addr);
+        key.addr[10] = 0xFF;
+        key.addr[11] = 0xFF;
+        memcpy(&key.addr[12], &v4->sin_addr, 4);
+        key.port = v4->sin_port;
+    }
+    return key;
+}
+
+uint32_t UdpServerTransport::hashKey(const PeerKey& key) {
+    uint64_t lo;
+    uint64_t hi;
+    memcpy(&lo, &key.addr[0], sizeof(lo));
+    memcpy(&hi, &key.addr[8], sizeof(hi));
+    uint64_t h = lo ^ (hi * 0x9E3779B97F4A7C15ull) ^
+                 (static_cast<uint64_t>(key.port) << 32 | key.scopeId);
+    // splitmix64 finalizer
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBull;
+    h ^= h >> 31;
+    return static_cast<uint32_t>(h);
+}
+
+int UdpServerTransport::indexOf(PeerId peer) const {
+    size_t slot = peer & 0xFFFF;
+    if (slot == 0 || slot > pool_.size()) {
+        return -1;
+    }
+    const Peer& p = pool_[slot - 1];
+    if (!p.active || p.generation != static_cast<uint16_t>(peer >> 16)) {
+        return -1;
+    }
+    return static_cast<int>(slot - 1);
+}
+
+PeerId UdpServerTransport::idOf(size_t index) const {
+    return static_cast<PeerId>(pool_[index].generation) << 16 |
+           static_cast<PeerId>(index + 1);
+}
+
+PeerId UdpServerTransport::lookupOrInsert(const struct sockaddr_storage& addr,
+                                          socklen_t addrLen) {
+    PeerKey key = makeKey(addr);
+    uint32_t hash = hashKey(key);
+
+    size_t i = hash & slotMask_;
+    while (slots_[i].peer != 0) {
+        if (slots_[i].hash == hash) {
+            size_t index = slots_[i].peer - 1;
+            Peer& p = pool_[index];
+            if (p.key == key) {
+                p.lastSeenMs = nowMs_;
+                return idOf(index);
+            }
+        }
+        i = (i + 1) & slotMask_;
+    }
+
+    if (freeList_.empty()) {
+        return kInvalidPeer;
+    }
+    uint32_t index = freeList_.back();
+    freeList_.pop_back();
+
+    Peer& p = pool_[index];
+    p.key = key;
+    memset(&p.addr, 0, sizeof(p.addr));
+    memcpy(&p.addr, &addr, std::min<size_t>(addrLen, sizeof(p.addr)));
+    p.addrLen = addrLen;
+    p.lastSeenMs = nowMs_;
+    p.active = true;
+    p.rxFrames = 0;
+    p.txFrames = 0;
+    slots_[i] = Slot{hash, index + 1};
+    peerCount_++;
+
+    PeerId id = idOf(index);
+    if (onPeerJoined_) {
+        onPeerJoined_(id);
+    }
+    return id;
+}
+
+void UdpServerTransport::release(size_t index) {
+    Peer& p = pool_[index];
+    uint32_t hash = hashKey(p.key);
+
+    size_t i = hash & slotMask_;
+    while (slots_[i].peer != index + 1) {
+        i = (i + 1) & slotMask_;
+    }
+
+    // Backward-shift deletion: no tombstones, probe chains stay short
+    size_t j = i;
+    for (;;) {
+        j = (j + 1) & slotMask_;
+        if (slots_[j].peer == 0) {
+            break;
+        }
+        size_t home = slots_[j].hash & slotMask_;
+        bool stays = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+        if (!stays) {
+            slots_[i] = slots_[j];
+            i = j;
+        }
+    }
+    slots_[i] = Slot{0, 0};
+
+    p.active = false;
+    p.generation++;  // Outstanding ids for this slot become stale
+    freeList_.push_back(static_cast<uint32_t>(index));
+    peerCount_--;
+}
+
+void UdpServerTransport::evictIdlePeers() {
+    for (size_t i = 0; i < pool_.size() && peerCount_ > 0; ++i) {
+        Peer& p = pool_[i];
+        if (p.active && nowMs_ - p.lastSeenMs >= config_.peerIdleTimeoutMs) {
+            PeerId id = idOf(i);
+            release(i);
+            if (onPeerLeft_) {
+                onPeerLeft_(id);
+            }
+        }
+    }
+}
+
+void UdpServerTransport::closeSocket() {
+#ifdef _WIN32
+    if (socket_ != INVALID_SOCKET) {
+        closesocket(socket_);
+        socket_ = INVALID_SOCKET;
+    }
+#else
+    if (socket_ >= 0) {
+        close(socket_);
+        socket_ = -1;
+    }
+#endif
+}
+
+void UdpServerTransport::cleanup() {
+    closeSocket();
+#ifdef _WIN32
+    if (winsockStarted_) {
+        WSACleanup();
+        winsockStarted_ = false;
+    }
+#endif
+    initialized_ = false;
+}
+
+}  // namespace oc::hal::net
@@ -0,0 +1,313 @@
+#pragma once
+
+/**
+ * @file UdpServerTransport.hpp
+ * @brief Multi-peer UDP transport for bridges and hubs
+ *
+ * UdpTransport talks to exactly one destination. UdpServerTransport binds
+ * a known port and serves every peer that sends to it: each new source
+ * address gets a PeerId, frames are delivered together with that id, and
+ * replies go back with sendTo(). Peers that stay silent longer than
+ * peerIdleTimeoutMs are evicted.
+ *
+ * Peers live in a fixed pool (maxPeers) indexed by a flat open-addressing
+ * hash table of 8-byte slots, so the per-datagram lookup is a hash plus a
+ * short linear probe with no allocation.
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * UdpServerConfig config;
+ * config.port = 9001;
+ *
+ * UdpServerTransport server(config);
+ * server.init();
+ *
+ * server.setOnPeerReceive([&](PeerId peer, const uint8_t* data, size_t len) {
+ *     server.sendTo(peer, data, len);  // Echo
+ * });
+ *
+ * // In main loop
+ * server.update();
+ * server.broadcast(stateFrame, stateLen);  // Every known peer
+ * ```
+ *
+ * ## ITransport Mapping
+ *
+ * - send() broadcasts to all peers
+ * - setOnReceive() callbacks get the payload without the peer id
+ *   (setOnPeerReceive() takes precedence while set)
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <oc/type/Result.hpp>
+#include <oc/interface/ITransport.hpp>
+
+#include "RateLimitedLog.hpp"
+#include "TransportStats.hpp"
+#include "UdpTransport.hpp"
+
+namespace oc::hal::net {
+
+/// Peer handle: stable while the peer is known, never reused for a new peer
+/// right away (0 = none)
+using PeerId = uint32_t;
+
+constexpr PeerId kInvalidPeer = 0;
+
+/**
+ * @brief Configuration for UdpServerTransport
+ */
+struct UdpServerConfig {
+    /// Port to bind (the one peers send to)
+    uint16_t port = 9001;
+
+    /// Socket address family (Any = dual-stack, IPv4 and IPv6 peers)
+    UdpAddressFamily addressFamily = UdpAddressFamily::Any;
+
+    /// Maximum concurrent peers (at most 65535); datagrams from further
+    /// peers are dropped until one is evicted
+    size_t maxPeers = 64;
+
+    /// Evict peers silent for this long (ms, 0 = never)
+    uint32_t peerIdleTimeoutMs = 10000;
+
+    /// Receive buffer size in bytes
+    size_t recvBufferSize = 4096;
+
+    /// Maximum datagrams dispatched per update()
+    size_t maxFramesPerUpdate = 16;
+
+    /// Allocator for the peer table and buffers (nullptr = default resource).
+    /// Must outlive the transport.
+    std::pmr::memory_resource* memoryResource = nullptr;
+
+    /// Minimum interval between repeated warnings (ms)
+    uint32_t logIntervalMs = 1000;
+};
+
+/**
+ * @brief Per-peer diagnostics returned by UdpServerTransport::peerInfo()
+ */
+struct UdpPeerInfo {
+    /// Numeric address ("192.168.1.20", "fe80::1"; IPv4 peers without ::ffff:)
+    std::string address;
+
+    uint16_t port = 0;
+
+    /// Time since the last datagram from this peer (ms)
+    uint32_t idleMs = 0;
+
+    uint64_t rxFrames = 0;
+    uint64_t txFrames = 0;
+};
+
+/**
+ * @brief UDP transport serving many peers on one bound port
+ *
+ * Single-threaded: update(), sendTo() and broadcast() must be called from
+ * the same thread. stats() may be read from anywhere.
+ */
+class UdpServerTransport : public interface::ITransport {
+public:
+    using PeerReceiveCallback =
+        std::function<void(PeerId peer, const uint8_t* data, size_t length)>;
+    using PeerEventCallback = std::function<void(PeerId peer)>;
+
+    UdpServerTransport();
+    explicit UdpServerTransport(const UdpServerConfig& config);
+    ~UdpServerTransport() override;
+
+    // Non-copyable, non-movable (peer ids are handed out by this instance)
+    UdpServerTransport(const UdpServerTransport&) = delete;
+    UdpServerTransport& operator=(const UdpServerTransport&) = delete;
+    UdpServerTransport(UdpServerTransport&&) = delete;
+    UdpServerTransport& operator=(UdpServerTransport&&) = delete;
+
+    // ═══════════════════════════════════════════════════════════════════════
+    // ITransport interface
+    // ═══════════════════════════════════════════════════════════════════════
+
+    /**
+     * @brief Open a non-blocking socket bound to config.port
+     *
+     * @return Result<void> - ok() on success, err() on failure
+     */
+    oc::type::Result<void> init() override;
+
+    /**
+     * @brief Receive up to maxFramesPerUpdate datagrams and evict idle peers
+     */
+    void update() override;
+
+    /// Broadcast to every known peer
+    void send(const uint8_t* data, size_t length) override;
+
+    void setOnReceive(ReceiveCallback cb) override;
+
+    bool isReady() const override;
+
+    // ═══════════════════════════════════════════════════════════════════════
+    // Server API
+    // ═══════════════════════════════════════════════════════════════════════
+
+    /// Receive callback with the sending peer (takes precedence over setOnReceive())
+    void setOnPeerReceive(PeerReceiveCallback cb);
+
+    /// Called when a peer sends its first datagram
+    void setOnPeerJoined(PeerEventCallback cb);
+
+    /// Called when a peer is evicted for inactivity (or removed via removePeer())
+    void setOnPeerLeft(PeerEventCallback cb);
+
+    /**
+     * @brief Receive frames straight into a handler, bypassing the callbacks
+     *
+     * @param handler Callable as handler(PeerId peer, const uint8_t* data, size_t length)
+     * @param maxFrames Maximum frames to receive in this call
+     * @return Number of frames handled
+     */
+    template <typename Handler>
+    size_t poll(Handler&& handler, size_t maxFrames = 1) {
+        if (!beginPoll()) {
+            return 0;
+        }
+        size_t count = 0;
+        PeerId peer;
+        size_t length;
+        while (count < maxFrames && receiveNext(peer, length)) {
+            handler(peer, static_cast<const uint8_t*>(recvBuffer_.data()), length);
+            count++;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Send one datagram to a peer
+     *
+     * @return false if peer is unknown (evicted or never seen) or the send failed
+     */
+    bool sendTo(PeerId peer, const uint8_t* data, size_t length);
+
+    /**
+     * @brief Send one datagram to every known peer
+     *
+     * @return Number of peers the datagram was handed to
+     */
+    size_t broadcast(const uint8_t* data, size_t length);
+
+    /// Forget a peer now; it gets a new id if it sends again
+    bool removePeer(PeerId peer);
+
+    /// True while peer is in the table
+    bool hasPeer(PeerId peer) const;
+
+    /// Number of known peers
+    size_t peerCount() const { return peerCount_; }
+
+    /// Ids of all known peers (allocates; for diagnostics and iteration)
+    std::vector<PeerId> peers() const;
+
+    /// Address and counters of a peer, false if unknown
+    bool peerInfo(PeerId peer, UdpPeerInfo& out) const;
+
+    /// Bound port (0 if not initialized)
+    uint16_t localPort() const;
+
+    /// Aggregate counters over all peers
+    TransportStats stats() const { return counters_.snapshot(); }
+
+    /// Reset cumulative counters to zero
+    void resetStats() { counters_.reset(); }
+
+    /// Datagrams dropped because the peer table was full
+    uint64_t rejectedDatagrams() const { return rejectedDatagrams_; }
+
+private:
+    /// Normalized peer address: IPv4 stored as ::ffff:a.b.c.d
+    struct PeerKey {
+        uint8_t addr[16];
+        uint32_t scopeId;
+        uint16_t port;
+
+        bool operator==(const PeerKey& other) const;
+    };
+
+    struct Peer {
+        PeerKey key;
+        struct sockaddr_storage addr;
+        socklen_t addrLen = 0;
+        uint32_t lastSeenMs = 0;
+        uint16_t generation = 0;
+        bool active = false;
+        uint64_t rxFrames = 0;
+        uint64_t txFrames = 0;
+    };
+
+    /// Hash index entry: peer = pool index + 1 (0 = empty)
+    struct Slot {
+        uint32_t hash;
+        uint32_t peer;
+    };
+
+    static PeerKey makeKey(const struct sockaddr_storage& addr);
+    static uint32_t hashKey(const PeerKey& key);
+
+    /// Pool index for id, or -1 if stale / unknown
+    int indexOf(PeerId peer) const;
+    PeerId idOf(size_t index) const;
+
+    /// Find or insert the sender; kInvalidPeer if the table is full
+    PeerId lookupOrInsert(const struct sockaddr_storage& addr, socklen_t addrLen);
+
+    /// Remove pool entry index from the hash index and the pool
+    void release(size_t index);
+
+    void evictIdlePeers();
+    bool sendToIndex(size_t index, const uint8_t* data, size_t length);
+    void closeSocket();
+    void cleanup();
+
+    /// Per-poll housekeeping (clock, eviction, deferred logs), false if not initialized
+    bool beginPoll();
+
+    /// Read one datagram into recvBuffer_, false when the socket is drained
+    bool receiveNext(PeerId& peer, size_t& length);
+
+    UdpServerConfig config_;
+    ReceiveCallback onReceive_;
+    PeerReceiveCallback onPeerReceive_;
+    PeerEventCallback onPeerJoined_;
+    PeerEventCallback onPeerLeft_;
+
+#ifdef _WIN32
+    SOCKET socket_ = INVALID_SOCKET;
+    bool winsockStarted_ = false;
+#else
+    int socket_ = -1;
+#endif
+    bool initialized_ = false;
+
+    std::pmr::vector<Peer> pool_;
+    std::pmr::vector<uint32_t> freeList_;  ///< Unused pool indices
+    std::pmr::vector<Slot> slots_;         ///< Power-of-two hash index
+    size_t slotMask_ = 0;
+    size_t peerCount_ = 0;
+
+    uint32_t nowMs_ = 0;  ///< Clock sampled once per update()
+    uint32_t lastSweepMs_ = 0;
+
+    std::pmr::vector<uint8_t> recvBuffer_;
+    TransportCounters counters_;
+    uint64_t rejectedDatagrams_ = 0;
+    RateLimitedLogSite sendFailedLog_;
+    RateLimitedLogSite tableFullLog_;
+};
+
+}  // namespace oc::hal::net
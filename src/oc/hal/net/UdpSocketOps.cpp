@@ -0,0 +1,155 @@
+#include "UdpSocketOps.hpp"
+
+#include <cstring>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+    #pragma comment(lib, "ws2_32.lib")
+#else
+    #include <arpa/inet.h>
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace oc::hal::net::detail {
+
+static_assert(sizeof(sockaddr_in) <= sizeof(UdpDestination::storage),
+              "UdpDestination too small for sockaddr_in");
+
+SocketHandle udpOpen(uint16_t localPort, int& error) {
+#ifdef _WIN32
+    // WSAStartup/WSACleanup are reference counted by Winsock itself
+    WSADATA wsaData;
+    error = WSAStartup(MAKEWORD(2, 2), &wsaData);
+    if (error != 0) {
+        return kInvalidSocket;
+    }
+    SOCKET s = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s == INVALID_SOCKET) {
+        error = WSAGetLastError();
+        WSACleanup();
+        return kInvalidSocket;
+    }
+    u_long nonBlocking = 1;
+    if (ioctlsocket(s, FIONBIO, &nonBlocking) != 0) {
+        error = WSAGetLastError();
+        closesocket(s);
+        WSACleanup();
+        return kInvalidSocket;
+    }
+#else
+    int s = socket(AF_INET, SOCK_DGRAM, 0);
+    if (s < 0) {
+        error = errno;
+        return kInvalidSocket;
+    }
+    int flags = fcntl(s, F_GETFL, 0);
+    if (flags < 0 || fcntl(s, F_SETFL, flags | O_NONBLOCK) < 0) {
+        error = errno;
+        close(s);
+        return kInvalidSocket;
+    }
+#endif
+
+    struct sockaddr_in localAddr;
+    memset(&localAddr, 0, sizeof(localAddr));
+    localAddr.sin_family = AF_INET;
+    localAddr.sin_addr.s_addr = INADDR_ANY;
+    localAddr.sin_port = htons(localPort);
+
+    if (bind(s, reinterpret_cast<struct sockaddr*>(&localAddr), sizeof(localAddr)) < 0) {
+#ifdef _WIN32
+        error = WSAGetLastError();
+#else
+        error = errno;
+#endif
+        udpClose(static_cast<SocketHandle>(s));
+        return kInvalidSocket;
+    }
+
+    error = 0;
+    return static_cast<SocketHandle>(s);
+}
+
+void udpClose(SocketHandle socket) {
+    if (socket == kInvalidSocket) {
+        return;
+    }
+#ifdef _WIN32
+    closesocket(static_cast<SOCKET>(socket));
+    WSACleanup();
+#else
+    close(static_cast<int>(socket));
+#endif
+}
+
+bool udpResolveIpv4(const char* host, uint16_t port, UdpDestination& out) {
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, host, &addr.sin_addr) != 1) {
+        return false;
+    }
+    memcpy(out.storage, &addr, sizeof(addr));
+    return true;
+}
+
+long udpSendTo(SocketHandle socket, const UdpDestination& dest,
+               const uint8_t* data, size_t length, int& error) {
+#ifdef _WIN32
+    int sent = sendto(static_cast<SOCKET>(socket), reinterpret_cast<const char*>(data),
+                      static_cast<int>(length), 0,
+                      reinterpret_cast<const struct sockaddr*>(dest.storage),
+                      sizeof(struct sockaddr_in));
+    error = sent < 0 ? WSAGetLastError() : 0;
+#else
+    ssize_t sent = sendto(static_cast<int>(socket), data, length, 0,
+                          reinterpret_cast<const struct sockaddr*>(dest.storage),
+                          sizeof(struct sockaddr_in));
+    error = sent < 0 ? errno : 0;
+#endif
+    return static_cast<long>(sent);
+}
+
+long udpReceive(SocketHandle socket, uint8_t* buffer, size_t capacity, bool& truncated) {
+    truncated = false;
+#ifdef _WIN32
+    int received = recv(static_cast<SOCKET>(socket), reinterpret_cast<char*>(buffer),
+                        static_cast<int>(capacity), 0);
+    if (received < 0) {
+        int error = WSAGetLastError();
+        if (error == WSAEMSGSIZE) {
+            truncated = true;
+            return static_cast<long>(capacity);
+        }
+        return error == WSAEWOULDBLOCK ? kUdpWouldBlock : -1;
+    }
+    return received;
+#else
+    struct iovec iov;
+    iov.iov_base = buffer;
+    iov.iov_len = capacity;
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    ssize_t received = recvmsg(static_cast<int>(socket), &msg, 0);
+    if (received < 0) {
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? kUdpWouldBlock : -1;
+    }
+    truncated = (msg.msg_flags & MSG_TRUNC) != 0;
+    return static_cast<long>(received);
+#endif
+}
+
+}  // namespace oc::hal::net::detail
@@ -0,0 +1,47 @@
+#pragma once
+
+/**
+ * @file UdpSocketOps.hpp
+ * @brief Thin cross-platform UDP socket wrappers for header-only transports
+ *
+ * Hides the Winsock / POSIX differences behind a handful of functions so
+ * templated transports (StaticUdpTransport) don't need platform headers
+ * full of #ifdefs. Not part of the public API.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace oc::hal::net::detail {
+
+/// Native socket handle widened to a common type (-1 = invalid)
+using SocketHandle = intptr_t;
+constexpr SocketHandle kInvalidSocket = -1;
+
+/// Opaque IPv4 destination (holds a sockaddr_in)
+struct UdpDestination {
+    alignas(8) uint8_t storage[16] = {};
+};
+
+/// Non-blocking IPv4 UDP socket bound to localPort (0 = any); kInvalidSocket on failure
+SocketHandle udpOpen(uint16_t localPort, int& error);
+
+/// Close a socket opened with udpOpen (no-op for kInvalidSocket)
+void udpClose(SocketHandle socket);
+
+/// Parse a dotted IPv4 host + port, false if the host is not a literal address
+bool udpResolveIpv4(const char* host, uint16_t port, UdpDestination& out);
+
+/// sendto(); returns bytes sent or -1 (error receives the OS error code)
+long udpSendTo(SocketHandle socket, const UdpDestination& dest,
+               const uint8_t* data, size_t length, int& error);
+
+/// udpReceive() result when no datagram is waiting
+constexpr long kUdpWouldBlock = -2;
+
+/// Non-blocking recv(); returns bytes received (0 for an empty datagram),
+/// kUdpWouldBlock when no datagram is waiting, -1 on error. truncated is
+/// set if the datagram did not fit.
+long udpReceive(SocketHandle socket, uint8_t* buffer, size_t capacity, bool& truncated);
+
+}  // namespace oc::hal::net::detail
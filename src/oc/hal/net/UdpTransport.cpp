@@ -1,15 +1,81 @@
 #include "UdpTransport.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
 #include <oc/log/Log.hpp>
+#include <oc/time/Time.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #include <immintrin.h>
+#endif
 
 #ifdef _WIN32
     #pragma comment(lib, "ws2_32.lib")
 #else
     #include <errno.h>
+    #include <net/if.h>
+    #include <poll.h>
+    #include <sys/ioctl.h>
+    #include <time.h>
+    #ifdef __linux__
+        #include <linux/net_tstamp.h>
+        #include <linux/sock_diag.h>
+    #endif
 #endif
 
 namespace oc::hal::net {
 
+namespace {
+
+bool isMulticastAddress(const ResolvedAddress& address) {
+    if (address.family() == AF_INET) {
+        const auto* v4 = reinterpret_cast<const struct sockaddr_in*>(&address.addr);
+        return (ntohl(v4->sin_addr.s_addr) & 0xF0000000u) == 0xE0000000u;  // 224.0.0.0/4
+    }
+    if (address.family() == AF_INET6) {
+        const auto* v6 = reinterpret_cast<const struct sockaddr_in6*>(&address.addr);
+        return v6->sin6_addr.s6_addr[0] == 0xFF;  // ff00::/8
+    }
+    return false;
+}
+
+uint64_t steadyNowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/// Spin-loop hint: lets the sibling hyperthread run and saves power
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+/// Convert a getsockopt(SO_RCVBUF) result back into setsockopt units.
+/// Linux reports twice the requested size (the extra half covers kernel
+/// bookkeeping), other platforms report the value as requested.
+int requestedBufferSize(int effective) {
+#ifdef __linux__
+    return effective / 2;
+#else
+    return effective;
+#endif
+}
+
+int lastSocketError() {
+#ifdef _WIN32
+    return WSAGetLastError();
+#else
+    return errno;
+#endif
+}
+
+}  // namespace
+
 // Static members for Winsock reference counting (Windows only)
 #ifdef _WIN32
 bool UdpTransport::winsockInitialized_ = false;
@@ -19,7 +85,11 @@ int UdpTransport::winsockRefCount_ = 0;
 UdpTransport::UdpTransport() : UdpTransport(UdpConfig{}) {}
 
 UdpTransport::UdpTransport(const UdpConfig& config)
-    : config_(config) {
+    : config_(config)
+    , resolver_(config.resolver ? config.resolver : &AddressResolver::shared())
+    , recvBuffer_(config.memoryResource ? config.memoryResource
+                                        : std::pmr::get_default_resource())
+    , sendFailedLog_(config.logIntervalMs) {
     recvBuffer_.resize(config_.recvBufferSize);
 }
 
@@ -30,16 +100,32 @@ UdpTransport::~UdpTransport() {
 UdpTransport::UdpTransport(UdpTransport&& other) noexcept
     : config_(std::move(other.config_))
     , onReceive_(std::move(other.onReceive_))
+    , onReceiveTimestamped_(std::move(other.onReceiveTimestamped_))
     , initialized_(other.initialized_)
     , socket_(other.socket_)
     , destAddr_(other.destAddr_)
-    , recvBuffer_(std::move(other.recvBuffer_)) {
+    , destAddrLen_(other.destAddrLen_)
+    , socketFamily_(other.socketFamily_)
+    , reresolvePending_(other.reresolvePending_.load(std::memory_order_relaxed))
+    , lastResolveMs_(other.lastResolveMs_)
+    , resolver_(other.resolver_)
+    , resolveTicket_(other.resolveTicket_)
+    , recvBuffer_(std::move(other.recvBuffer_))
+    , counters_(other.counters_)
+    , sendFailedLog_(other.sendFailedLog_)
+    , lastKernelDropCount_(other.lastKernelDropCount_)
+    , effectiveRecvBufferSize_(other.effectiveRecvBufferSize_)
+    , lastAdaptiveCheckMs_(other.lastAdaptiveCheckMs_)
+    , adaptiveSettled_(other.adaptiveSettled_)
+    , lastFrameNs_(other.lastFrameNs_)
+    , waitStats_(other.waitStats_) {
 #ifdef _WIN32
     other.socket_ = INVALID_SOCKET;
 #else
     other.socket_ = -1;
 #endif
     other.initialized_ = false;
+    other.resolveTicket_ = 0;
 }
 
 UdpTransport& UdpTransport::operator=(UdpTransport&& other) noexcept {
@@ -47,16 +133,33 @@ UdpTransport& UdpTransport::operator=(UdpTransport&& other) noexcept {
         cleanup();
         config_ = std::move(other.config_);
         onReceive_ = std::move(other.onReceive_);
+        onReceiveTimestamped_ = std::move(other.onReceiveTimestamped_);
         initialized_ = other.initialized_;
         socket_ = other.socket_;
         destAddr_ = other.destAddr_;
+        destAddrLen_ = other.destAddrLen_;
+        socketFamily_ = other.socketFamily_;
+        reresolvePending_.store(other.reresolvePending_.load(std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+        lastResolveMs_ = other.lastResolveMs_;
+        resolver_ = other.resolver_;
+        resolveTicket_ = other.resolveTicket_;
         recvBuffer_ = std::move(other.recvBuffer_);
+        counters_ = other.counters_;
+        sendFailedLog_ = other.sendFailedLog_;
+        lastKernelDropCount_ = other.lastKernelDropCount_;
+        effectiveRecvBufferSize_ = other.effectiveRecvBufferSize_;
+        lastAdaptiveCheckMs_ = other.lastAdaptiveCheckMs_;
+        adaptiveSettled_ = other.adaptiveSettled_;
+        lastFrameNs_ = other.lastFrameNs_;
+        waitStats_ = other.waitStats_;
 #ifdef _WIN32
         other.socket_ = INVALID_SOCKET;
 #else
         other.socket_ = -1;
 #endif
         other.initialized_ = false;
+        other.resolveTicket_ = 0;
     }
     return *this;
 }
@@ -80,20 +183,42 @@ oc::type::Result<void> UdpTransport::init() {
     winsockRefCount_++;
 #endif
 
-    // Create UDP socket
-#ifdef _WIN32
-    socket_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-    if (socket_ == INVALID_SOCKET) {
-        OC_LOG_ERROR("UDP: Failed to create socket: {}", WSAGetLastError());
+    // A multicast group fixes the socket family (IP_* vs IPV6_* options)
+    ResolvedAddress group;
+    bool multicast = AddressResolver::parseNumeric(config_.host, AF_UNSPEC, group) &&
+                     isMulticastAddress(group);
+    if (config_.multicastJoin && !multicast) {
+        OC_LOG_ERROR("UDP: multicastJoin needs a numeric group address, got {}",
+                     config_.host.c_str());
+        cleanup();
         return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
     }
+
+    // Create UDP socket: dual-stack IPv6 unless restricted, IPv4 as fallback
+    bool opened = false;
+    if (multicast) {
+        int family = group.family();
+        if ((family == AF_INET && config_.addressFamily != UdpAddressFamily::IPv6) ||
+            (family == AF_INET6 && config_.addressFamily != UdpAddressFamily::IPv4)) {
+            opened = openSocket(family);
+        }
+    } else {
+        if (config_.addressFamily != UdpAddressFamily::IPv4) {
+            opened = openSocket(AF_INET6);
+        }
+        if (!opened && config_.addressFamily != UdpAddressFamily::IPv6) {
+            opened = openSocket(AF_INET);
+        }
+    }
+    if (!opened) {
+#ifdef _WIN32
+        OC_LOG_ERROR("UDP: Failed to create socket: {}", WSAGetLastError());
 #else
-    socket_ = socket(AF_INET, SOCK_DGRAM, 0);
-    if (socket_ < 0) {
         OC_LOG_ERROR("UDP: Failed to create socket: {}", errno);
+#endif
+        cleanup();
         return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
     }
-#endif
 
     // Set non-blocking mode
 #ifdef _WIN32
@@ -112,14 +237,43 @@ oc::type::Result<void> UdpTransport::init() {
     }
 #endif
 
-    // Bind to receive responses (use any available port)
-    struct sockaddr_in localAddr;
+    // Group members share the port (SO_REUSEPORT is what BSDs check for multicast)
+    if (config_.multicastJoin) {
+        int reuse = 1;
+        setsockopt(socket_, SOL_SOCKET, SO_REUSEADDR,
+                   reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+#if defined(SO_REUSEPORT) && !defined(__linux__)
+        setsockopt(socket_, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse));
+#endif
+    }
+
+    if (config_.broadcast) {
+        int enable = 1;
+        if (setsockopt(socket_, SOL_SOCKET, SO_BROADCAST,
+                       reinterpret_cast<const char*>(&enable), sizeof(enable)) != 0) {
+            OC_LOG_WARN("UDP: SO_BROADCAST failed: {}", lastSocketError());
+        }
+    }
+
+    // Bind to receive responses (localPort 0 = any available port)
+    struct sockaddr_storage localAddr;
     memset(&localAddr, 0, sizeof(localAddr));
-    localAddr.sin_family = AF_INET;
-    localAddr.sin_addr.s_addr = INADDR_ANY;
-    localAddr.sin_port = 0;  // Let OS choose port
+    socklen_t localAddrLen;
+    if (socketFamily_ == AF_INET6) {
+        auto* local6 = reinterpret_cast<struct sockaddr_in6*>(&localAddr);
+        local6->sin6_family = AF_INET6;
+        local6->sin6_addr = in6addr_any;
+        local6->sin6_port = htons(config_.localPort);
+        localAddrLen = sizeof(struct sockaddr_in6);
+    } else {
+        auto* local4 = reinterpret_cast<struct sockaddr_in*>(&localAddr);
+        local4->sin_family = AF_INET;
+        local4->sin_addr.s_addr = INADDR_ANY;
+        local4->sin_port = htons(config_.localPort);
+        localAddrLen = sizeof(struct sockaddr_in);
+    }
 
-    if (bind(socket_, reinterpret_cast<struct sockaddr*>(&localAddr), sizeof(localAddr)) < 0) {
+    if (bind(socket_, reinterpret_cast<struct sockaddr*>(&localAddr), localAddrLen) < 0) {
 #ifdef _WIN32
         OC_LOG_ERROR("UDP: Bind failed: {}", WSAGetLastError());
 #else
@@ -129,59 +283,234 @@ oc::type::Result<void> UdpTransport::init() {
         return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
     }
 
-    // Setup destination address
-    memset(&destAddr_, 0, sizeof(destAddr_));
-    destAddr_.sin_family = AF_INET;
-    destAddr_.sin_port = htons(config_.port);
-    
-#ifdef _WIN32
-    inet_pton(AF_INET, config_.host.c_str(), &destAddr_.sin_addr);
-#else
-    inet_pton(AF_INET, config_.host.c_str(), &destAddr_.sin_addr);
+#ifdef SO_RXQ_OVFL
+    // Ask the kernel to attach its receive-queue drop counter to each datagram
+    int enable = 1;
+    if (setsockopt(socket_, SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable)) < 0) {
+        OC_LOG_WARN("UDP: SO_RXQ_OVFL unavailable, kernel drops not tracked: {}", errno);
+    }
 #endif
+    lastKernelDropCount_ = 0;
+
+    // Socket buffer sizes (OS defaults unless configured)
+    effectiveRecvBufferSize_ = applySocketBufferSize(true, config_.socketRecvBufferSize);
+    int effectiveSendBufferSize = applySocketBufferSize(false, config_.socketSendBufferSize);
+    if (config_.socketRecvBufferSize > 0 || config_.socketSendBufferSize > 0) {
+        OC_LOG_INFO("UDP: Socket buffers rcv={} snd={} bytes",
+                    effectiveRecvBufferSize_, effectiveSendBufferSize);
+    }
+    lastAdaptiveCheckMs_ = oc::time::millis();
+    adaptiveSettled_ = false;
 
+    enableRxTimestamps();
+    enableBusyPoll();
+    applyTrafficClass();
+
+    if (multicast && !configureMulticast(group)) {
+        cleanup();
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+
+    // Numeric or cached destination now, hostnames on the resolver thread
     initialized_ = true;
+    if (!startResolve(false)) {
+        cleanup();
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+
     OC_LOG_INFO("UDP: Initialized, target {}:{}", config_.host.c_str(), config_.port);
     return oc::type::Result<void>::ok();
 }
 
 void UdpTransport::update() {
-    if (!initialized_ || !onReceive_) {
+    if (!beginPoll()) {
         return;
     }
+    (void)drainReceived();
+}
+
+size_t UdpTransport::drainReceived() {
+    if (!onReceive_ && !onReceiveTimestamped_) {
+        return 0;
+    }
 
+    size_t count = 0;
+    size_t length;
+    int64_t kernelTimestampNs;
+    while (count < config_.maxFramesPerUpdate && receiveNext(length, kernelTimestampNs)) {
+        dispatch(length, kernelTimestampNs);
+        count++;
+    }
+    return count;
+}
+
+size_t UdpTransport::waitAndUpdate(uint32_t timeoutMs) {
+    if (!beginPoll() || (!onReceive_ && !onReceiveTimestamped_)) {
+        return 0;
+    }
+
+    const uint64_t startNs = steadyNowNs();
+    const uint64_t deadlineNs = startNs + static_cast<uint64_t>(timeoutMs) * 1000000;
+    const uint64_t spinNs = static_cast<uint64_t>(config_.spinIdleUs) * 1000;
+    bool blocked = false;
+
+    for (uint64_t now = startNs;; now = steadyNowNs()) {
+        size_t count = drainReceived();
+        if (count > 0) {
+            lastFrameNs_ = steadyNowNs();
+            (blocked ? waitStats_.blockingWakeups : waitStats_.spinWakeups)++;
+            return count;
+        }
+        if (now >= deadlineNs) {
+            break;
+        }
+
+        // Traffic was recent: keep spinning, a wakeup would cost more
+        if (now - lastFrameNs_ < spinNs) {
+            cpuRelax();
+            continue;
+        }
+
+        // Idle: sleep in the kernel until data arrives (round up to whole ms)
+        waitStats_.blockingWaits++;
+        blocked = true;
+        int waitMs = static_cast<int>((deadlineNs - now + 999999) / 1000000);
+        if (!waitReadable(waitMs)) {
+            break;
+        }
+    }
+
+    waitStats_.timeouts++;
+    return 0;
+}
+
+bool UdpTransport::waitReadable(int timeoutMs) const {
+#ifdef _WIN32
+    WSAPOLLFD pfd{};
+    pfd.fd = socket_;
+    pfd.events = POLLRDNORM;
+    return WSAPoll(&pfd, 1, timeoutMs) > 0;
+#else
+    struct pollfd pfd{};
+    pfd.fd = socket_;
+    pfd.events = POLLIN;
+    int ready;
+    do {
+        ready = ::poll(&pfd, 1, timeoutMs);
+    } while (ready < 0 && errno == EINTR);
+    return ready > 0;
+#endif
+}
+
+bool UdpTransport::beginPoll() {
+    if (!initialized_) {
+        return false;
+    }
+
+    if (config_.adaptiveRecvBuffer) {
+        uint32_t now = oc::time::millis();
+        if (now - lastAdaptiveCheckMs_ >= config_.adaptiveCheckIntervalMs) {
+            lastAdaptiveCheckMs_ = now;
+            adaptRecvBuffer(false);
+        }
+    }
+
+    // Background lookup finished: apply it, or retry after reresolveIntervalMs
+    if (resolveTicket_ != 0) {
+        ResolveResult result;
+        ResolveStatus status = resolver_->poll(resolveTicket_, result);
+        if (status != ResolveStatus::Pending) {
+            resolveTicket_ = 0;
+            if (status == ResolveStatus::Done && !applyResolution(result)) {
+                reresolvePending_.store(true, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Stale destination reported by send(): re-resolve off the send path
+    if (resolveTicket_ == 0 && config_.reresolveIntervalMs > 0 &&
+        reresolvePending_.load(std::memory_order_relaxed)) {
+        uint32_t now = oc::time::millis();
+        if (now - lastResolveMs_ >= config_.reresolveIntervalMs) {
+            reresolvePending_.store(false, std::memory_order_relaxed);
+            (void)startResolve(true);  // Keeps the previous address on failure
+        }
+    }
+
+    // Send failures are only counted in send(); format them here
+    sendFailedLog_.flush([](uint64_t count, int64_t lastError) {
+        OC_LOG_WARN("UDP: Send failed: {} ({}x)", lastError, count);
+    });
+    return true;
+}
+
+bool UdpTransport::receiveNext(size_t& length, int64_t& kernelTimestampNs) {
     // Non-blocking receive
-    struct sockaddr_in senderAddr;
+    struct sockaddr_storage senderAddr;
 #ifdef _WIN32
-    int addrLen = sizeof(senderAddr);
-    int bytesReceived = recvfrom(
-        socket_,
-        reinterpret_cast<char*>(recvBuffer_.data()),
-        static_cast<int>(recvBuffer_.size()),
-        0,
-        reinterpret_cast<struct sockaddr*>(&senderAddr),
-        &addrLen
-    );
+    for (;;) {
+        int addrLen = sizeof(senderAddr);
+        int bytesReceived = recvfrom(
+            socket_,
+            reinterpret_cast<char*>(recvBuffer_.data()),
+            static_cast<int>(recvBuffer_.size()),
+            0,
+            reinterpret_cast<struct sockaddr*>(&senderAddr),
+            &addrLen
+        );
 
-    if (bytesReceived > 0) {
-        onReceive_(recvBuffer_.data(), static_cast<size_t>(bytesReceived));
+        if (bytesReceived > 0) {
+            length = static_cast<size_t>(bytesReceived);
+            kernelTimestampNs = 0;
+            counters_.onReceive(length);
+            return true;
+        }
+        if (bytesReceived < 0 && WSAGetLastError() == WSAEMSGSIZE) {
+            // Datagram larger than recvBuffer_ - Winsock discards it
+            counters_.onTruncation();
+            continue;
+        }
+        if (bytesReceived < 0) {
+            // WSAEWOULDBLOCK is expected for non-blocking sockets with no data
+            return false;
+        }
+        // Empty datagram: nothing to deliver, keep reading
     }
-    // WSAEWOULDBLOCK is expected for non-blocking sockets with no data
 #else
-    socklen_t addrLen = sizeof(senderAddr);
-    ssize_t bytesReceived = recvfrom(
-        socket_,
-        recvBuffer_.data(),
-        recvBuffer_.size(),
-        0,
-        reinterpret_cast<struct sockaddr*>(&senderAddr),
-        &addrLen
-    );
+    struct iovec iov;
+    iov.iov_base = recvBuffer_.data();
+    iov.iov_len = recvBuffer_.size();
+
+    // Ancillary data (kernel drop counter, arrival timestamp)
+    alignas(struct cmsghdr) uint8_t control[kControlBufferSize];
+
+    struct msghdr msg;
+    for (;;) {
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name = &senderAddr;
+        msg.msg_namelen = sizeof(senderAddr);
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
 
-    if (bytesReceived > 0) {
-        onReceive_(recvBuffer_.data(), static_cast<size_t>(bytesReceived));
+        ssize_t bytesReceived = recvmsg(socket_, &msg, 0);
+
+        if (bytesReceived > 0) {
+            kernelTimestampNs = processControlMessages(msg);
+            if (msg.msg_flags & MSG_TRUNC) {
+                counters_.onTruncation();
+            }
+            length = static_cast<size_t>(bytesReceived);
+            counters_.onReceive(length);
+            return true;
+        }
+        if (bytesReceived < 0) {
+            // EAGAIN/EWOULDBLOCK is expected for non-blocking sockets with no data
+            return false;
+        }
+        // Empty datagram: nothing to deliver, keep reading
     }
-    // EAGAIN/EWOULDBLOCK is expected for non-blocking sockets with no data
 #endif
 }
 
@@ -189,6 +518,13 @@ void UdpTransport::send(const uint8_t* data, size_t length) {
     if (!initialized_) {
         return;
     }
+    struct sockaddr_storage dest;
+    socklen_t destLen = loadDestination(&dest);
+    if (destLen == 0) {
+        // Hostname not resolved yet
+        counters_.onSendError();
+        return;
+    }
 
 #ifdef _WIN32
     int bytesSent = sendto(
@@ -196,34 +532,665 @@ void UdpTransport::send(const uint8_t* data, size_t length) {
         reinterpret_cast<const char*>(data),
         static_cast<int>(length),
         0,
-        reinterpret_cast<const struct sockaddr*>(&destAddr_),
-        sizeof(destAddr_)
+        reinterpret_cast<const struct sockaddr*>(&dest),
+        destLen
     );
-
-    if (bytesSent < 0) {
-        OC_LOG_WARN("UDP: Send failed: {}", WSAGetLastError());
-    }
+    finishSend(bytesSent, bytesSent < 0 ? WSAGetLastError() : 0);
 #else
     ssize_t bytesSent = sendto(
         socket_,
         data,
         length,
         0,
-        reinterpret_cast<const struct sockaddr*>(&destAddr_),
-        sizeof(destAddr_)
+        reinterpret_cast<const struct sockaddr*>(&dest),
+        destLen
     );
+    finishSend(static_cast<long>(bytesSent), bytesSent < 0 ? errno : 0);
+#endif
+}
 
-    if (bytesSent < 0) {
-        OC_LOG_WARN("UDP: Send failed: {}", errno);
+void UdpTransport::sendMarked(const uint8_t* data, size_t length, uint8_t dscp) {
+#ifdef __linux__
+    if (!initialized_) {
+        return;
+    }
+    struct sockaddr_storage dest;
+    socklen_t destLen = loadDestination(&dest);
+    if (destLen == 0) {
+        counters_.onSendError();
+        return;
     }
+
+    // IPv4 and v4-mapped destinations take IP_TOS, native IPv6 takes IPV6_TCLASS
+    const auto* dest6 = reinterpret_cast<const struct sockaddr_in6*>(&dest);
+    bool ipv6 = dest.ss_family == AF_INET6 && !IN6_IS_ADDR_V4MAPPED(&dest6->sin6_addr);
+    int trafficClass = (dscp & 0x3F) << 2;  // DSCP is the upper 6 bits, ECN left 0
+
+    struct iovec iov;
+    iov.iov_base = const_cast<uint8_t*>(data);
+    iov.iov_len = length;
+
+    alignas(struct cmsghdr) uint8_t control[CMSG_SPACE(sizeof(int))];
+    memset(control, 0, sizeof(control));
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = &dest;
+    msg.msg_namelen = destLen;
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = ipv6 ? IPPROTO_IPV6 : IPPROTO_IP;
+    cmsg->cmsg_type = ipv6 ? IPV6_TCLASS : IP_TOS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &trafficClass, sizeof(int));
+
+    ssize_t bytesSent = sendmsg(socket_, &msg, 0);
+    finishSend(static_cast<long>(bytesSent), bytesSent < 0 ? errno : 0);
+#else
+    (void)dscp;  // No per-datagram TOS here; config.dscp still applies
+    send(data, length);
 #endif
 }
 
+void UdpTransport::finishSend(long bytesSent, int error) {
+    if (bytesSent < 0) {
+        counters_.onSendError();
+        sendFailedLog_.hit(error);
+        if (isAddressError(error)) {
+            reresolvePending_.store(true, std::memory_order_relaxed);
+        }
+    } else {
+        counters_.onSend(static_cast<size_t>(bytesSent));
+    }
+}
+
 void UdpTransport::setOnReceive(ReceiveCallback cb) {
     onReceive_ = std::move(cb);
 }
 
+void UdpTransport::setOnReceiveTimestamped(TimestampedReceiveCallback cb) {
+    onReceiveTimestamped_ = std::move(cb);
+}
+
+void UdpTransport::dispatch(size_t length, int64_t kernelTimestampNs) {
+    if (onReceiveTimestamped_) {
+        RxTimestamps ts;
+        ts.kernelNs = kernelTimestampNs;
+        ts.userNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::system_clock::now().time_since_epoch())
+                        .count();
+        onReceiveTimestamped_(recvBuffer_.data(), length, ts);
+    } else {
+        onReceive_(recvBuffer_.data(), length);
+    }
+}
+
+void UdpTransport::enableRxTimestamps() {
+    if (config_.rxTimestamps == RxTimestampMode::None) {
+        return;
+    }
+
+#if defined(__linux__) && defined(SO_TIMESTAMPING)
+    if (config_.rxTimestamps == RxTimestampMode::Hardware) {
+        // Raw NIC timestamps (if the driver has them enabled via SIOCSHWTSTAMP),
+        // plus software timestamps as a fallback
+        int flags = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE |
+                    SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+        if (setsockopt(socket_, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == 0) {
+            return;
+        }
+        OC_LOG_WARN("UDP: SO_TIMESTAMPING failed ({}), using software timestamps", errno);
+    }
+#endif
+
+#if defined(SO_TIMESTAMPNS)
+    int enable = 1;
+    if (setsockopt(socket_, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) < 0) {
+        OC_LOG_WARN("UDP: SO_TIMESTAMPNS unavailable: {}", errno);
+    }
+#elif defined(SO_TIMESTAMP) && !defined(_WIN32)
+    int enable = 1;
+    if (setsockopt(socket_, SOL_SOCKET, SO_TIMESTAMP, &enable, sizeof(enable)) < 0) {
+        OC_LOG_WARN("UDP: SO_TIMESTAMP unavailable: {}", errno);
+    }
+#else
+    OC_LOG_WARN("UDP: Kernel receive timestamps not supported on this platform");
+#endif
+}
+
+uint16_t UdpTransport::localPort() const {
+    if (!initialized_) {
+        return 0;
+    }
+
+    struct sockaddr_storage localAddr;
+    socklen_t addrLen = sizeof(localAddr);
+    if (getsockname(socket_, reinterpret_cast<struct sockaddr*>(&localAddr), &addrLen) != 0) {
+        return 0;
+    }
+    if (localAddr.ss_family == AF_INET6) {
+        return ntohs(reinterpret_cast<const struct sockaddr_in6*>(&localAddr)->sin6_port);
+    }
+    return ntohs(reinterpret_cast<const struct sockaddr_in*>(&localAddr)->sin_port);
+}
+
+UdpSocketInfo UdpTransport::socketInfo() const {
+    UdpSocketInfo info;
+    if (!initialized_) {
+        return info;
+    }
+
+#ifdef _WIN32
+    // FIONREAD only sizes the next datagram here: queue depth unknown
+    int optLen = sizeof(int);
+    getsockopt(socket_, SOL_SOCKET, SO_RCVBUF,
+               reinterpret_cast<char*>(&info.recvBufferSize), &optLen);
+    optLen = sizeof(int);
+    getsockopt(socket_, SOL_SOCKET, SO_SNDBUF,
+               reinterpret_cast<char*>(&info.sendBufferSize), &optLen);
+#else
+#if defined(__linux__) && defined(SO_MEMINFO)
+    // Linux FIONREAD only sizes the next datagram; SO_MEMINFO reports the
+    // memory charged to the whole queue, which the kernel checks against SO_RCVBUF
+    uint32_t meminfo[SK_MEMINFO_VARS] = {};
+    socklen_t memLen = sizeof(meminfo);
+    if (getsockopt(socket_, SOL_SOCKET, SO_MEMINFO, meminfo, &memLen) == 0) {
+        info.queuedBytes = meminfo[SK_MEMINFO_RMEM_ALLOC];
+        info.queueDepthKnown = true;
+    }
+#elif !defined(__linux__)
+    // BSD / macOS: FIONREAD counts every byte buffered on the socket
+    int queued = 0;
+    if (ioctl(socket_, FIONREAD, &queued) == 0) {
+        info.queuedBytes = queued > 0 ? static_cast<size_t>(queued) : 0;
+        info.queueDepthKnown = true;
+    }
+#endif
+    socklen_t optLen = sizeof(int);
+    getsockopt(socket_, SOL_SOCKET, SO_RCVBUF, &info.recvBufferSize, &optLen);
+    optLen = sizeof(int);
+    getsockopt(socket_, SOL_SOCKET, SO_SNDBUF, &info.sendBufferSize, &optLen);
+#endif
+
+    return info;
+}
+
+int UdpTransport::applySocketBufferSize(bool receive, int bytes) {
+    const int option = receive ? SO_RCVBUF : SO_SNDBUF;
+
+    if (bytes > 0) {
+        bool applied = false;
+#if defined(SO_RCVBUFFORCE) && defined(SO_SNDBUFFORCE)
+        if (config_.forceSocketBufferSize) {
+            // Bypasses rmem_max/wmem_max, fails with EPERM without CAP_NET_ADMIN
+            const int forceOption = receive ? SO_RCVBUFFORCE : SO_SNDBUFFORCE;
+            applied = setsockopt(socket_, SOL_SOCKET, forceOption, &bytes, sizeof(bytes)) == 0;
+        }
+#endif
+        if (!applied) {
+#ifdef _WIN32
+            applied = setsockopt(socket_, SOL_SOCKET, option,
+                                 reinterpret_cast<const char*>(&bytes), sizeof(bytes)) == 0;
+#else
+            applied = setsockopt(socket_, SOL_SOCKET, option, &bytes, sizeof(bytes)) == 0;
+#endif
+        }
+        if (!applied) {
+#ifdef _WIN32
+            OC_LOG_WARN("UDP: Failed to set {} to {}: {}",
+                        receive ? "SO_RCVBUF" : "SO_SNDBUF", bytes, WSAGetLastError());
+#else
+            OC_LOG_WARN("UDP: Failed to set {} to {}: {}",
+                        receive ? "SO_RCVBUF" : "SO_SNDBUF", bytes, errno);
+#endif
+        }
+    }
+
+    // The OS may clamp (rmem_max) or adjust (Linux doubles) the value
+    int effective = 0;
+#ifdef _WIN32
+    int optLen = sizeof(effective);
+    getsockopt(socket_, SOL_SOCKET, option, reinterpret_cast<char*>(&effective), &optLen);
+#else
+    socklen_t optLen = sizeof(effective);
+    getsockopt(socket_, SOL_SOCKET, option, &effective, &optLen);
+#endif
+    return effective;
+}
+
+void UdpTransport::adaptRecvBuffer(bool dropsObserved) {
+    if (adaptiveSettled_ || effectiveRecvBufferSize_ <= 0) {
+        return;
+    }
+
+    if (!dropsObserved) {
+        // High-water mark: queue more than 3/4 full. Both sides are in the
+        // kernel's own accounting units (reported SO_RCVBUF vs charged memory).
+        UdpSocketInfo info = socketInfo();
+        if (!info.queueDepthKnown ||
+            info.queuedBytes < static_cast<size_t>(effectiveRecvBufferSize_) / 4 * 3) {
+            return;
+        }
+    }
+
+    // Double and cap in setsockopt units so Linux's reported doubling
+    // does not compound into 4x steps or overshoot adaptiveRecvBufferMax
+    int previous = effectiveRecvBufferSize_;
+    int requested = std::min(requestedBufferSize(previous) * 2, config_.adaptiveRecvBufferMax);
+    int effective = applySocketBufferSize(true, requested);
+    if (effective > previous) {
+        effectiveRecvBufferSize_ = effective;
+        OC_LOG_INFO("UDP: Receive buffer grown to {} bytes ({})", effective,
+                    dropsObserved ? "kernel drops" : "queue high-water");
+    }
+
+    // Reached the configured cap, or clamped by the OS (net.core.rmem_max)
+    if (effective <= previous ||
+        requestedBufferSize(effective) >= config_.adaptiveRecvBufferMax) {
+        adaptiveSettled_ = true;
+        OC_LOG_INFO("UDP: Adaptive receive buffer settled at {} bytes",
+                    effectiveRecvBufferSize_);
+    }
+}
+
+#ifndef _WIN32
+int64_t UdpTransport::processControlMessages(const struct msghdr& msg) {
+    int64_t kernelTimestampNs = 0;
+
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(const_cast<struct msghdr*>(&msg), cmsg)) {
+#ifdef SO_RXQ_OVFL
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL) {
+            // Cumulative per-socket counter (wraps at 2^32)
+            uint32_t dropCount;
+            memcpy(&dropCount, CMSG_DATA(cmsg), sizeof(dropCount));
+            uint32_t delta = dropCount - lastKernelDropCount_;
+            if (delta > 0) {
+                counters_.onKernelDrops(delta);
+                if (config_.adaptiveRecvBuffer) {
+                    adaptRecvBuffer(true);
+                }
+            }
+            lastKernelDropCount_ = dropCount;
+        }
+#endif
+#if defined(__linux__) && defined(SCM_TIMESTAMPING)
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPING) {
+            // ts[0] = software, ts[1] = deprecated, ts[2] = raw hardware
+            struct timespec ts[3];
+            memcpy(ts, CMSG_DATA(cmsg), sizeof(ts));
+            const struct timespec& best = (ts[2].tv_sec != 0 || ts[2].tv_nsec != 0) ? ts[2] : ts[0];
+            kernelTimestampNs = static_cast<int64_t>(best.tv_sec) * 1000000000LL + best.tv_nsec;
+        }
+#endif
+#ifdef SCM_TIMESTAMPNS
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+            struct timespec ts;
+            memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+            kernelTimestampNs = static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+        }
+#elif defined(SCM_TIMESTAMP)
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMP) {
+            struct timeval tv;
+            memcpy(&tv, CMSG_DATA(cmsg), sizeof(tv));
+            kernelTimestampNs = static_cast<int64_t>(tv.tv_sec) * 1000000000LL +
+                                static_cast<int64_t>(tv.tv_usec) * 1000;
+        }
+#endif
+    }
+
+    return kernelTimestampNs;
+}
+#endif
+
+bool UdpTransport::openSocket(int family) {
+#ifdef _WIN32
+    socket_ = socket(family, SOCK_DGRAM, IPPROTO_UDP);
+    if (socket_ == INVALID_SOCKET) {
+        return false;
+    }
+#else
+    socket_ = socket(family, SOCK_DGRAM, 0);
+    if (socket_ < 0) {
+        return false;
+    }
+#endif
+
+    if (family == AF_INET6) {
+        // Dual-stack unless IPv6 was requested explicitly (Windows defaults to v6-only)
+        int v6only = config_.addressFamily == UdpAddressFamily::IPv6 ? 1 : 0;
+        if (setsockopt(socket_, IPPROTO_IPV6, IPV6_V6ONLY,
+                       reinterpret_cast<const char*>(&v6only), sizeof(v6only)) != 0 &&
+            v6only == 0) {
+            // No dual-stack on this system: let the caller fall back to IPv4
+#ifdef _WIN32
+            closesocket(socket_);
+            socket_ = INVALID_SOCKET;
+#else
+            close(socket_);
+            socket_ = -1;
+#endif
+            return false;
+        }
+    }
+
+    socketFamily_ = family;
+    return true;
+}
+
+bool UdpTransport::configureMulticast(const ResolvedAddress& group) {
+    auto setOption = [this](int level, int name, const void* value, size_t size) {
+        return setsockopt(socket_, level, name, static_cast<const char*>(value),
+                          static_cast<socklen_t>(size)) == 0;
+    };
+    const bool hasInterface = !config_.multicastInterface.empty();
+
+    if (group.family() == AF_INET) {
+        const auto* groupAddr = reinterpret_cast<const struct sockaddr_in*>(&group.addr);
+
+        // Interface by address, or by index where the platform accepts one
+        struct in_addr ifaddr;
+        ifaddr.s_addr = htonl(INADDR_ANY);
+        unsigned ifindex = 0;
+        if (hasInterface &&
+            inet_pton(AF_INET, config_.multicastInterface.c_str(), &ifaddr) != 1) {
+            ifaddr.s_addr = htonl(INADDR_ANY);
+            ifindex = multicastInterfaceIndex();
+#ifdef _WIN32
+            ifaddr.s_addr = htonl(ifindex);  // Winsock reads 0.0.0.x as an interface index
+#elif !defined(__linux__)
+            if (ifindex != 0) {
+                OC_LOG_WARN("UDP: IPv4 multicast interface must be an address here, got {}",
+                            config_.multicastInterface.c_str());
+                ifindex = 0;
+            }
+#endif
+            if (ifindex == 0) {
+                OC_LOG_WARN("UDP: Unknown multicast interface {}",
+                            config_.multicastInterface.c_str());
+            }
+        }
+
+#ifdef _WIN32
+        DWORD ttl = static_cast<DWORD>(config_.multicastTtl);
+        DWORD loop = config_.multicastLoopback ? 1 : 0;
+#else
+        // BSDs only accept a single byte for these two
+        unsigned char ttl = static_cast<unsigned char>(config_.multicastTtl);
+        unsigned char loop = config_.multicastLoopback ? 1 : 0;
+#endif
+        if (!setOption(IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl))) {
+            OC_LOG_WARN("UDP: IP_MULTICAST_TTL failed: {}", lastSocketError());
+        }
+        if (!setOption(IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop))) {
+            OC_LOG_WARN("UDP: IP_MULTICAST_LOOP failed: {}", lastSocketError());
+        }
+
+#ifdef __linux__
+        struct ip_mreqn mreq;
+        memset(&mreq, 0, sizeof(mreq));
+        mreq.imr_multiaddr = groupAddr->sin_addr;
+        mreq.imr_address = ifaddr;
+        mreq.imr_ifindex = static_cast<int>(ifindex);
+        const void* ifOption = &mreq;
+        size_t ifOptionSize = sizeof(mreq);
+#else
+        struct ip_mreq mreq;
+        memset(&mreq, 0, sizeof(mreq));
+        mreq.imr_multiaddr = groupAddr->sin_addr;
+        mreq.imr_interface = ifaddr;
+        const void* ifOption = &ifaddr;
+        size_t ifOptionSize = sizeof(ifaddr);
+#endif
+        if (hasInterface && !setOption(IPPROTO_IP, IP_MULTICAST_IF, ifOption, ifOptionSize)) {
+            OC_LOG_WARN("UDP: IP_MULTICAST_IF failed: {}", lastSocketError());
+        }
+        if (config_.multicastJoin &&
+            !setOption(IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq))) {
+            OC_LOG_ERROR("UDP: Failed to join {}: {}", config_.host.c_str(), lastSocketError());
+            return false;
+        }
+    } else {
+        const auto* groupAddr = reinterpret_cast<const struct sockaddr_in6*>(&group.addr);
+        unsigned ifindex = multicastInterfaceIndex();
+        if (hasInterface && ifindex == 0) {
+            OC_LOG_WARN("UDP: Unknown multicast interface {}",
+                        config_.multicastInterface.c_str());
+        }
+
+        int hops = config_.multicastTtl;
+        unsigned loop = config_.multicastLoopback ? 1 : 0;
+        if (!setOption(IPPROTO_IPV6, IPV6_MULTICAST_HOPS, &hops, sizeof(hops))) {
+            OC_LOG_WARN("UDP: IPV6_MULTICAST_HOPS failed: {}", lastSocketError());
+        }
+        if (!setOption(IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &loop, sizeof(loop))) {
+            OC_LOG_WARN("UDP: IPV6_MULTICAST_LOOP failed: {}", lastSocketError());
+        }
+        if (ifindex != 0 &&
+            !setOption(IPPROTO_IPV6, IPV6_MULTICAST_IF, &ifindex, sizeof(ifindex))) {
+            OC_LOG_WARN("UDP: IPV6_MULTICAST_IF failed: {}", lastSocketError());
+        }
+
+        struct ipv6_mreq mreq;
+        memset(&mreq, 0, sizeof(mreq));
+        mreq.ipv6mr_multiaddr = groupAddr->sin6_addr;
+        mreq.ipv6mr_interface = ifindex;
+        if (config_.multicastJoin &&
+            !setOption(IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq))) {
+            OC_LOG_ERROR("UDP: Failed to join {}: {}", config_.host.c_str(), lastSocketError());
+            return false;
+        }
+    }
+
+    if (config_.multicastJoin) {
+        OC_LOG_INFO("UDP: Joined multicast group {} on port {}",
+                    config_.host.c_str(), config_.localPort);
+    }
+    return true;
+}
+
+unsigned UdpTransport::multicastInterfaceIndex() const {
+    const std::string& name = config_.multicastInterface;
+    if (name.empty()) {
+        return 0;
+    }
+    if (std::all_of(name.begin(), name.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+        return static_cast<unsigned>(strtoul(name.c_str(), nullptr, 10));
+    }
+#ifdef _WIN32
+    return 0;  // Windows interface names are not supported; use the index
+#else
+    return if_nametoindex(name.c_str());
+#endif
+}
+
+void UdpTransport::enableBusyPoll() {
+    if (config_.busyPollUs > 0) {
+#ifdef SO_BUSY_POLL
+        int usecs = static_cast<int>(config_.busyPollUs);
+        if (setsockopt(socket_, SOL_SOCKET, SO_BUSY_POLL, &usecs, sizeof(usecs)) != 0) {
+            OC_LOG_WARN("UDP: SO_BUSY_POLL {}us failed: {}", usecs, lastSocketError());
+        }
+#else
+        OC_LOG_WARN("UDP: SO_BUSY_POLL not supported on this platform");
+#endif
+    }
+
+    if (config_.preferBusyPoll) {
+#ifdef SO_PREFER_BUSY_POLL
+        int on = 1;
+        if (setsockopt(socket_, SOL_SOCKET, SO_PREFER_BUSY_POLL, &on, sizeof(on)) != 0) {
+            OC_LOG_WARN("UDP: SO_PREFER_BUSY_POLL failed: {}", lastSocketError());
+        }
+#else
+        OC_LOG_WARN("UDP: SO_PREFER_BUSY_POLL not supported on this platform");
+#endif
+    }
+}
+
+void UdpTransport::applyTrafficClass() {
+    if (config_.dscp >= 0) {
+        if (config_.dscp > 63) {
+            OC_LOG_WARN("UDP: Ignoring invalid DSCP {}", config_.dscp);
+        } else {
+            int trafficClass = config_.dscp << 2;
+            if (socketFamily_ == AF_INET6) {
+                if (setsockopt(socket_, IPPROTO_IPV6, IPV6_TCLASS,
+                               reinterpret_cast<const char*>(&trafficClass),
+                               sizeof(trafficClass)) != 0) {
+                    OC_LOG_WARN("UDP: IPV6_TCLASS failed: {}", lastSocketError());
+                }
+            }
+            // On a dual-stack socket IPv4 traffic still uses IP_TOS (Linux);
+            // other systems may refuse it there, which is harmless
+            if (setsockopt(socket_, IPPROTO_IP, IP_TOS,
+                           reinterpret_cast<const char*>(&trafficClass),
+                           sizeof(trafficClass)) != 0 &&
+                socketFamily_ == AF_INET) {
+                OC_LOG_WARN("UDP: IP_TOS failed: {}", lastSocketError());
+            }
+        }
+    }
+
+    if (config_.socketPriority >= 0) {
+#ifdef SO_PRIORITY
+        if (setsockopt(socket_, SOL_SOCKET, SO_PRIORITY, &config_.socketPriority,
+                       sizeof(config_.socketPriority)) != 0) {
+            OC_LOG_WARN("UDP: SO_PRIORITY {} failed: {}", config_.socketPriority,
+                        lastSocketError());
+        }
+#else
+        OC_LOG_WARN("UDP: SO_PRIORITY not supported on this platform");
+#endif
+    }
+}
+
+oc::type::Result<void> UdpTransport::resolve() {
+    if (!initialized_) {
+        return oc::type::Result<void>::err(oc::type::ErrorCode::INVALID_STATE);
+    }
+    if (!startResolve(true)) {
+        return oc::type::Result<void>::err(oc::type::ErrorCode::HARDWARE_INIT_FAILED);
+    }
+    return oc::type::Result<void>::ok();
+}
+
+int UdpTransport::resolveFamily() const {
+    if (socketFamily_ == AF_INET) {
+        return AF_INET;
+    }
+    return config_.addressFamily == UdpAddressFamily::IPv6 ? AF_INET6 : AF_UNSPEC;
+}
+
+bool UdpTransport::startResolve(bool bypassCache) {
+    lastResolveMs_ = oc::time::millis();
+    if (resolveTicket_ != 0) {
+        resolver_->cancel(resolveTicket_);
+        resolveTicket_ = 0;
+    }
+
+    // Literals need no lookup (any family: applyResolution() rejects mismatches)
+    ResolveResult result;
+    ResolvedAddress numeric;
+    if (AddressResolver::parseNumeric(config_.host, AF_UNSPEC, numeric)) {
+        result.addresses.push_back(numeric);
+        return applyResolution(result);
+    }
+
+    if (!bypassCache && resolver_->cached(config_.host, resolveFamily(), result)) {
+        if (!applyResolution(result)) {
+            reresolvePending_.store(true, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    resolveTicket_ = resolver_->request(config_.host, resolveFamily(), bypassCache);
+    return true;
+}
+
+bool UdpTransport::applyResolution(const ResolveResult& result) {
+    if (!result.ok()) {
+        OC_LOG_ERROR("UDP: Cannot resolve {}: {}", config_.host.c_str(), result.error);
+        return false;
+    }
+
+    // First result in the resolver's preference order that the socket can reach
+    struct sockaddr_storage dest;
+    socklen_t destLen = 0;
+    for (const ResolvedAddress& address : result.addresses) {
+        if (address.family() == socketFamily_) {
+            memset(&dest, 0, sizeof(dest));
+            memcpy(&dest, &address.addr, address.length);
+            destLen = address.length;
+        } else if (address.family() == AF_INET && socketFamily_ == AF_INET6 &&
+                   config_.addressFamily == UdpAddressFamily::Any) {
+            // IPv4 destination on a dual-stack socket: use the v4-mapped form
+            const auto* v4 = reinterpret_cast<const struct sockaddr_in*>(&address.addr);
+            struct sockaddr_in6 mapped;
+            memset(&mapped, 0, sizeof(mapped));
+            mapped.sin6_family = AF_INET6;
+            mapped.sin6_addr.s6_addr[10] = 0xFF;
+            mapped.sin6_addr.s6_addr[11] = 0xFF;
+            memcpy(&mapped.sin6_addr.s6_addr[12], &v4->sin_addr, 4);
+            memset(&dest, 0, sizeof(dest));
+            memcpy(&dest, &mapped, sizeof(mapped));
+            destLen = sizeof(mapped);
+        } else {
+            continue;
+        }
+
+        // Lookups carry no port
+        if (socketFamily_ == AF_INET6) {
+            reinterpret_cast<struct sockaddr_in6*>(&dest)->sin6_port = htons(config_.port);
+        } else {
+            reinterpret_cast<struct sockaddr_in*>(&dest)->sin_port = htons(config_.port);
+        }
+        storeDestination(dest, destLen);
+        return true;
+    }
+
+    OC_LOG_ERROR("UDP: No usable address for {} on this socket", config_.host.c_str());
+    return false;
+}
+
+socklen_t UdpTransport::loadDestination(struct sockaddr_storage* out) const {
+    std::lock_guard<std::mutex> lock(destMutex_);
+    if (out != nullptr && destAddrLen_ > 0) {
+        memcpy(out, &destAddr_, destAddrLen_);
+    }
+    return destAddrLen_;
+}
+
+void UdpTransport::storeDestination(const struct sockaddr_storage& addr, socklen_t length) {
+    std::lock_guard<std::mutex> lock(destMutex_);
+    memcpy(&destAddr_, &addr, length);
+    destAddrLen_ = length;
+}
+
+bool UdpTransport::isAddressError(int error) {
+#ifdef _WIN32
+    return error == WSAEHOSTUNREACH || error == WSAENETUNREACH ||
+           error == WSAEADDRNOTAVAIL || error == WSAEAFNOSUPPORT;
+#else
+    return error == EHOSTUNREACH || error == ENETUNREACH ||
+           error == EADDRNOTAVAIL || error == EAFNOSUPPORT;
+#endif
+}
+
 void UdpTransport::cleanup() {
+    if (resolveTicket_ != 0) {
+        resolver_->cancel(resolveTicket_);
+        resolveTicket_ = 0;
+    }
+    {
+        std::lock_guard<std::mutex> lock(destMutex_);
+        destAddrLen_ = 0;
+    }
+
 #ifdef _WIN32
     if (socket_ != INVALID_SOCKET) {
         closesocket(socket_);
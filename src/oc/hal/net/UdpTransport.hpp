@@ -35,6 +35,31 @@
  * transport.send(frameData, frameLen);
  * ```
  *
+ * ## Multicast
+ *
+ * With host set to a numeric IPv4/IPv6 group address, one send() reaches
+ * every subscriber. Receivers join the group and bind the group port:
+ *
+ * ```cpp
+ * UdpConfig config;
+ * config.host = "239.255.0.1";
+ * config.port = 9100;
+ * config.localPort = 9100;      // Receivers: bind the group port
+ * config.multicastJoin = true;  // Receivers only; senders just send
+ * config.multicastInterface = "lo";
+ * ```
+ *
+ * ## Traffic Class
+ *
+ * config.dscp marks every datagram (IP_TOS / IPV6_TCLASS) so switches and
+ * qdiscs can prioritize controller traffic; sendMarked() overrides the
+ * code point per datagram, e.g. EF (46) for control frames next to
+ * best-effort meters. Check the marking with a capture on loopback:
+ *
+ * ```
+ * tcpdump -i lo -v -n udp port 9001   # IPv4: "tos 0xb8", IPv6: "class 0xb8"
+ * ```
+ *
  * ## Platform Notes
  *
  * - Windows: Uses Winsock2 (ws2_32.lib required)
@@ -42,15 +67,23 @@
  * - No COBS encoding (oc-bridge Virtual mode uses RawCodec)
  */
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
+#include <memory_resource>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include <oc/type/Result.hpp>
 #include <oc/interface/ITransport.hpp>
 
+#include "AddressResolver.hpp"
+#include "RateLimitedLog.hpp"
+#include "TransportStats.hpp"
+
 #ifdef _WIN32
     #ifndef WIN32_LEAN_AND_MEAN
         #define WIN32_LEAN_AND_MEAN
@@ -67,18 +100,172 @@
 
 namespace oc::hal::net {
 
+/**
+ * @brief Kernel receive timestamp source
+ */
+enum class RxTimestampMode {
+    None,      ///< No kernel timestamps (RxTimestamps::kernelNs = 0)
+    Software,  ///< Socket arrival time (SO_TIMESTAMPNS, SO_TIMESTAMP on macOS)
+    Hardware   ///< NIC time via SO_TIMESTAMPING (Linux), software fallback
+};
+
+/**
+ * @brief Arrival times passed to the timestamped receive callback
+ *
+ * Both values are nanoseconds since the Unix epoch (CLOCK_REALTIME), so
+ * userNs - kernelNs is the time the frame spent waiting for update().
+ */
+struct RxTimestamps {
+    /// When the kernel (or NIC) received the datagram, 0 if unavailable
+    int64_t kernelNs = 0;
+
+    /// When update() read the datagram from the socket
+    int64_t userNs = 0;
+};
+
+/**
+ * @brief Address family used by UdpTransport
+ */
+enum class UdpAddressFamily {
+    Any,   ///< Dual-stack IPv6 socket (reaches IPv4 too), IPv4 if IPv6 is unavailable
+    IPv4,  ///< IPv4 only
+    IPv6   ///< IPv6 only (IPV6_V6ONLY)
+};
+
 /**
  * @brief Configuration for UdpTransport
  */
 struct UdpConfig {
-    /// Host address to connect to (default: localhost)
+    /// Destination host: IPv4/IPv6 literal or hostname (resolved in the background)
     std::string host = "127.0.0.1";
     
     /// Port to send/receive on (default: oc-bridge virtual_port)
     uint16_t port = 9001;
+
+    /// Local port to bind for receiving (0 = let the OS choose)
+    uint16_t localPort = 0;
     
     /// Receive buffer size in bytes
     size_t recvBufferSize = 4096;
+
+    /// Maximum datagrams dispatched per update() (raise to drain bursts)
+    size_t maxFramesPerUpdate = 1;
+
+    /// Requested socket receive buffer (SO_RCVBUF) in bytes (0 = OS default)
+    int socketRecvBufferSize = 0;
+
+    /// Requested socket send buffer (SO_SNDBUF) in bytes (0 = OS default)
+    int socketSendBufferSize = 0;
+
+    /// Use SO_RCVBUFFORCE/SO_SNDBUFFORCE to exceed net.core.[rw]mem_max
+    /// (Linux, needs CAP_NET_ADMIN; falls back to the regular option)
+    bool forceSocketBufferSize = false;
+
+    /// Grow SO_RCVBUF at runtime when kernel drops or a nearly full
+    /// receive queue are observed (the latter only where
+    /// UdpSocketInfo::queueDepthKnown; Windows relies on drops alone)
+    bool adaptiveRecvBuffer = false;
+
+    /// Upper bound for adaptive growth in bytes, in setsockopt units
+    /// (Linux reports up to twice this value through getsockopt)
+    int adaptiveRecvBufferMax = 8 * 1024 * 1024;
+
+    /// How often update() samples the receive queue depth in adaptive mode (ms)
+    uint32_t adaptiveCheckIntervalMs = 250;
+
+    /// Kernel arrival timestamps for setOnReceiveTimestamped() (not on Windows)
+    RxTimestampMode rxTimestamps = RxTimestampMode::None;
+
+    /// Allocator for internal buffers (nullptr = std::pmr::get_default_resource()).
+    /// Must outlive the transport.
+    std::pmr::memory_resource* memoryResource = nullptr;
+
+    /// Minimum interval between repeated send-failure warnings (ms); failures
+    /// in between are counted and reported in the next line
+    uint32_t logIntervalMs = 1000;
+
+    /// Socket / resolution address family
+    UdpAddressFamily addressFamily = UdpAddressFamily::Any;
+
+    /// After a send fails with an unreachable-address error, re-resolve host
+    /// from update() at most this often (ms, 0 = only on explicit resolve())
+    uint32_t reresolveIntervalMs = 5000;
+
+    /// Resolver for hostnames (nullptr = AddressResolver::shared()).
+    /// Must outlive the transport.
+    AddressResolver* resolver = nullptr;
+
+    /// Join host's multicast group to receive from it (host must be a
+    /// numeric group address; set localPort = port). Several transports on
+    /// one host may join the same group and port.
+    bool multicastJoin = false;
+
+    /// Hop limit for datagrams sent to a multicast group (1 = local subnet)
+    int multicastTtl = 1;
+
+    /// Deliver our own multicast datagrams to group members on this host
+    bool multicastLoopback = true;
+
+    /// Interface for multicast send and join: IPv4 address, interface name
+    /// or index ("127.0.0.1", "lo", "2"); empty = OS routing decides
+    std::string multicastInterface;
+
+    /// Allow sending to IPv4 broadcast addresses (SO_BROADCAST)
+    bool broadcast = false;
+
+    /// DSCP code point for all outgoing datagrams (0-63, e.g. 46 = EF,
+    /// 34 = AF41; -1 = OS default). Sets IP_TOS and/or IPV6_TCLASS.
+    int dscp = -1;
+
+    /// SO_PRIORITY for all outgoing datagrams (Linux; 0-6 without
+    /// CAP_NET_ADMIN; -1 = OS default). Selects the qdisc band / VLAN PCP.
+    int socketPriority = -1;
+
+    /// SO_BUSY_POLL budget (µs, Linux; 0 = off): receive calls poll the NIC
+    /// queue instead of waiting for the interrupt. Raising it above
+    /// net.core.busy_read needs CAP_NET_ADMIN.
+    uint32_t busyPollUs = 0;
+
+    /// SO_PREFER_BUSY_POLL (Linux 5.11+): keep device interrupts deferred
+    /// while the application busy-polls
+    bool preferBusyPoll = false;
+
+    /// waitAndUpdate() spins on the socket for this long after the last
+    /// frame before falling back to a blocking wait (µs; 0 = always block)
+    uint32_t spinIdleUs = 0;
+};
+
+/**
+ * @brief Socket-level diagnostics for UdpTransport
+ *
+ * Queried on demand via UdpTransport::socketInfo() (three socket calls -
+ * not meant for the per-frame path).
+ */
+struct UdpSocketInfo {
+    /// Receive queue occupancy, in the same units the OS checks against
+    /// recvBufferSize: charged kernel memory including per-datagram
+    /// overhead on Linux (SO_MEMINFO), buffered bytes on macOS/BSD (FIONREAD)
+    size_t queuedBytes = 0;
+
+    /// queuedBytes covers the whole queue. False on Windows and on Linux
+    /// kernels without SO_MEMINFO (< 4.6), where queuedBytes stays 0.
+    bool queueDepthKnown = false;
+
+    /// Effective SO_RCVBUF as reported by the OS (Linux reports 2x the requested value)
+    int recvBufferSize = 0;
+
+    /// Effective SO_SNDBUF as reported by the OS
+    int sendBufferSize = 0;
+};
+
+/**
+ * @brief Wakeup counters of UdpTransport::waitAndUpdate()
+ */
+struct UdpWaitStats {
+    uint64_t spinWakeups = 0;      ///< Frames found while spinning
+    uint64_t blockingWakeups = 0;  ///< Frames found after a blocking wait
+    uint64_t blockingWaits = 0;    ///< Times the spin phase gave up and blocked
+    uint64_t timeouts = 0;         ///< Calls that returned without a frame
 };
 
 /**
@@ -91,9 +278,15 @@ struct UdpConfig {
  * - Non-blocking socket for use in game loops
  * - No framing overhead (UDP datagrams are naturally delimited)
  * - Cross-platform (Windows/Linux/macOS)
+ *
+ * Receiving (update()/poll()/waitAndUpdate()) belongs to one thread;
+ * send() may run on another. init() must return before either starts.
  */
 class UdpTransport : public interface::ITransport {
 public:
+    using TimestampedReceiveCallback =
+        std::function<void(const uint8_t* data, size_t length, const RxTimestamps& ts)>;
+
     UdpTransport();
     explicit UdpTransport(const UdpConfig& config);
     ~UdpTransport() override;
@@ -109,8 +302,13 @@ public:
     /**
      * @brief Initialize the UDP socket
      *
-     * Creates a non-blocking UDP socket and binds it for receiving.
-     * On Windows, initializes Winsock if needed.
+     * Creates a non-blocking UDP socket (dual-stack IPv6 unless
+     * addressFamily says otherwise) and binds it for receiving. A numeric
+     * host is converted immediately; a hostname is looked up on the
+     * resolver thread and picked up by update(), so init() never waits
+     * on DNS. send() only uses the cached address.
+     * Applies the configured socket buffer sizes (failures are logged,
+     * not fatal). On Windows, initializes Winsock if needed.
      *
      * @return Result<void> - ok() on success, err() on failure
      */
@@ -119,9 +317,13 @@ public:
     /**
      * @brief Poll for incoming frames
      *
-     * Checks for available data on the socket and dispatches
-     * complete frames via the receive callback.
+     * Checks for available data on the socket and dispatches up to
+     * maxFramesPerUpdate frames via the receive callback.
      * Non-blocking - returns immediately if no data available.
+     *
+     * With adaptiveRecvBuffer, doubles the requested SO_RCVBUF (up to
+     * adaptiveRecvBufferMax) whenever kernel drops are reported or the
+     * receive queue is found above 3/4 of the buffer (see socketInfo()).
      */
     void update() override;
 
@@ -136,6 +338,18 @@ public:
      */
     void send(const uint8_t* data, size_t length) override;
 
+    /**
+     * @brief Send a frame with its own DSCP marking
+     *
+     * Overrides UdpConfig::dscp for this datagram only via an IP_TOS /
+     * IPV6_TCLASS control message (sendmsg), e.g. EF for control frames
+     * on a socket that otherwise carries best-effort bulk data. Linux
+     * only; elsewhere the frame is sent with the socket-level marking.
+     *
+     * @param dscp DSCP code point (0-63)
+     */
+    void sendMarked(const uint8_t* data, size_t length, uint8_t dscp);
+
     /**
      * @brief Set callback for received frames
      *
@@ -144,15 +358,194 @@ public:
     void setOnReceive(ReceiveCallback cb) override;
 
     /**
-     * @brief Check if transport is initialized and ready
+     * @brief Set callback for received frames with arrival timestamps
+     *
+     * Takes precedence over setOnReceive() while set. Enable
+     * UdpConfig::rxTimestamps to get kernel timestamps, otherwise only
+     * RxTimestamps::userNs is filled.
+     *
+     * @param cb Callback invoked with each frame and its timestamps
      */
-    bool isReady() const override { return initialized_; }
+    void setOnReceiveTimestamped(TimestampedReceiveCallback cb);
+
+    /**
+     * @brief Receive frames straight into a handler, bypassing ReceiveCallback
+     *
+     * Same as update() but the handler is a template parameter, so the
+     * compiler can inline it into the receive loop instead of going
+     * through std::function. Use on hot paths that own the transport:
+     *
+     * ```cpp
+     * transport.poll([&](const uint8_t* data, size_t len) {
+     *     parser.feed(data, len);
+     * }, 64);
+     * ```
+     *
+     * @param handler Callable as handler(const uint8_t* data, size_t length)
+     * @param maxFrames Maximum frames to receive in this call
+     * @return Number of frames handled
+     */
+    template <typename Handler>
+    size_t poll(Handler&& handler, size_t maxFrames = 1) {
+        if (!beginPoll()) {
+            return 0;
+        }
+        size_t count = 0;
+        size_t length;
+        int64_t kernelTimestampNs;
+        while (count < maxFrames && receiveNext(length, kernelTimestampNs)) {
+            handler(static_cast<const uint8_t*>(recvBuffer_.data()), length);
+            count++;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Wait for frames, then dispatch them like update()
+     *
+     * For a dedicated receive thread that trades a core for wakeup
+     * latency. While frames arrived within the last spinIdleUs, the socket
+     * is polled in a tight loop (each non-blocking read also busy-polls the
+     * NIC with busyPollUs set); after that the thread blocks in poll()
+     * until a datagram arrives, and spins again once traffic resumes.
+     * With spinIdleUs = 0 this is a plain blocking receive loop.
+     *
+     * The application thread may keep calling send() meanwhile: a
+     * re-resolved destination is published under a lock, and send()
+     * hands stale-address errors back through an atomic flag.
+     *
+     * ```cpp
+     * config.busyPollUs = 50;
+     * config.spinIdleUs = 2000;  // Spin through gaps up to 2 ms
+     *
+     * while (running) transport.waitAndUpdate(100);
+     * ```
+     *
+     * @param timeoutMs Longest time to wait for the first frame
+     * @return Number of frames dispatched (0 on timeout)
+     */
+    size_t waitAndUpdate(uint32_t timeoutMs);
+
+    /// Spin / blocking counters of waitAndUpdate()
+    const UdpWaitStats& waitStats() const { return waitStats_; }
+
+    /**
+     * @brief Check if transport is initialized and has a destination
+     *
+     * False while the first lookup of a hostname is still running.
+     */
+    bool isReady() const override { return initialized_ && loadDestination(nullptr) > 0; }
+
+    /**
+     * @brief Snapshot of frame/byte/error counters
+     *
+     * Safe to call from any thread. kernelDrops is taken from the
+     * SO_RXQ_OVFL counter (Linux only) and lags by one datagram: drops are
+     * reported when the next datagram is received. bufferedFrames,
+     * droppedOldest and reconnects stay 0: UDP is connectionless and sends
+     * are never queued.
+     */
+    TransportStats stats() const { return counters_.snapshot(); }
+
+    /// Reset cumulative counters to zero
+    void resetStats() { counters_.reset(); }
+
+    /**
+     * @brief Query receive queue depth and effective socket buffer sizes
+     *
+     * Where queueDepthKnown is set, compare queuedBytes against
+     * recvBufferSize to spot overload before the kernel starts dropping.
+     * Returns zeros if not initialized.
+     */
+    UdpSocketInfo socketInfo() const;
+
+    /**
+     * @brief Resolve config.host again and replace the cached destination
+     *
+     * Numeric hosts are applied immediately. Hostnames bypass the resolver
+     * cache and are applied by a later update(); the call itself does not
+     * block. The previous destination is kept if resolution fails.
+     *
+     * @return err() if not initialized or a numeric host is unusable
+     */
+    oc::type::Result<void> resolve();
+
+    /**
+     * @brief Local port the socket is bound to (0 if not initialized)
+     *
+     * Useful with UdpConfig::localPort = 0 to tell a peer where to reply.
+     */
+    uint16_t localPort() const;
 
 private:
     void cleanup();
 
+    /// Create the socket for family (AF_INET / AF_INET6), false on failure
+    bool openSocket(int family);
+
+    /// Apply TTL/loopback/interface for a multicast destination and join
+    /// the group if configured; false if the join fails
+    bool configureMulticast(const ResolvedAddress& group);
+
+    /// Index of config.multicastInterface (0 = default or unknown)
+    unsigned multicastInterfaceIndex() const;
+
+    /// Apply config.dscp / config.socketPriority (failures are logged, not fatal)
+    void applyTrafficClass();
+
+    /// Update counters and deferred logs after sendto()/sendmsg()
+    void finishSend(long bytesSent, int error);
+
+    /// getaddrinfo family matching the open socket
+    int resolveFamily() const;
+
+    /// Apply a numeric or cached address, or queue a lookup; false if unusable
+    bool startResolve(bool bypassCache);
+
+    /// Pick the first address the socket can reach as destination
+    bool applyResolution(const ResolveResult& result);
+
+    /// Copy the destination into out (if not null), returns its length (0 = none)
+    socklen_t loadDestination(struct sockaddr_storage* out) const;
+
+    /// Publish a new destination to send()
+    void storeDestination(const struct sockaddr_storage& addr, socklen_t length);
+
+    /// True for send errors that suggest the cached destination is stale
+    static bool isAddressError(int error);
+
+    /// Set SO_RCVBUF (receive) or SO_SNDBUF, returns the effective size
+    int applySocketBufferSize(bool receive, int bytes);
+    void adaptRecvBuffer(bool dropsObserved);
+    void enableRxTimestamps();
+
+    /// Apply config.busyPollUs / config.preferBusyPoll (failures are logged, not fatal)
+    void enableBusyPoll();
+
+    /// Dispatch up to maxFramesPerUpdate waiting frames, returns the count
+    size_t drainReceived();
+
+    /// Block until the socket is readable or timeoutMs passes
+    bool waitReadable(int timeoutMs) const;
+    void dispatch(size_t length, int64_t kernelTimestampNs);
+
+    /// Per-poll housekeeping (adaptive buffer, deferred logs), false if not initialized
+    bool beginPoll();
+
+    /// Read one datagram into recvBuffer_, false when the socket is drained
+    bool receiveNext(size_t& length, int64_t& kernelTimestampNs);
+
+#ifndef _WIN32
+    /// Room for SO_RXQ_OVFL + SCM_TIMESTAMPING ancillary data per datagram
+    static constexpr size_t kControlBufferSize = 128;
+
+    /// Returns the kernel arrival timestamp in ns (0 if none attached)
+    int64_t processControlMessages(const struct msghdr& msg);
+#endif
+
     UdpConfig config_;
     ReceiveCallback onReceive_;
+    TimestampedReceiveCallback onReceiveTimestamped_;
     bool initialized_ = false;
 
 #ifdef _WIN32
@@ -163,8 +556,29 @@ private:
     int socket_ = -1;
 #endif
 
-    struct sockaddr_in destAddr_;
-    std::vector<uint8_t> recvBuffer_;
+    // Cached destination (sockaddr_in, sockaddr_in6 or v4-mapped sockaddr_in6).
+    // Rewritten by re-resolution on the receive thread, read by send().
+    mutable std::mutex destMutex_;
+    struct sockaddr_storage destAddr_;
+    socklen_t destAddrLen_ = 0;
+    int socketFamily_ = 0;
+    std::atomic<bool> reresolvePending_{false};  ///< Set by send(), consumed by beginPoll()
+    uint32_t lastResolveMs_ = 0;
+    AddressResolver* resolver_;
+    AddressResolver::Ticket resolveTicket_ = 0;  ///< In-flight hostname lookup
+    std::pmr::vector<uint8_t> recvBuffer_;
+    TransportCounters counters_;
+    RateLimitedLogSite sendFailedLog_;
+    uint32_t lastKernelDropCount_ = 0;
+
+    // Adaptive SO_RCVBUF state
+    int effectiveRecvBufferSize_ = 0;
+    uint32_t lastAdaptiveCheckMs_ = 0;
+    bool adaptiveSettled_ = false;
+
+    // waitAndUpdate() state
+    uint64_t lastFrameNs_ = 0;
+    UdpWaitStats waitStats_;
 };
 
 }  // namespace oc::hal::net
@@ -23,7 +23,12 @@ WebSocketTransport::WebSocketTransport()
 
 WebSocketTransport::WebSocketTransport(const WebSocketConfig& config)
     : config_(config)
-    , currentDelayMs_(config.reconnectDelayMs) {}
+    , framePool_(16, config.memoryResource)
+    , pendingMessages_(config.memoryResource ? config.memoryResource
+                                             : std::pmr::get_default_resource())
+    , currentDelayMs_(config.reconnectDelayMs)
+    , sendFailedLog_(config.logIntervalMs)
+    , bufferFullLog_(config.logIntervalMs) {}
 
 WebSocketTransport::~WebSocketTransport() {
     if (socket_ > 0) {
@@ -49,12 +54,20 @@ oc::type::Result<void> WebSocketTransport::init() {
 }
 
 void WebSocketTransport::update() {
+    sendFailedLog_.flush([](uint64_t count, int64_t lastResult) {
+        OC_LOG_WARN("[WebSocket] Send failed: {} ({}x)", lastResult, count);
+    });
+    bufferFullLog_.flush([](uint64_t count, int64_t) {
+        OC_LOG_WARN("[WebSocket] Buffer full, dropped {} oldest message(s)", count);
+    });
+
     // Reconnection logic (messages are handled by async callbacks)
     if (state_ == State::Disconnected && config_.autoReconnect) {
         uint32_t now = oc::time::millis();
         if (now - lastAttemptMs_ >= currentDelayMs_) {
             OC_LOG_INFO("[WebSocket] Attempting reconnect (attempt {})...", 
                         reconnectAttempts_ + 1);
+            counters_.onReconnect();
             connect();
             lastAttemptMs_ = now;
         }
@@ -70,19 +83,24 @@ void WebSocketTransport::send(const uint8_t* data, size_t length) {
             static_cast<uint32_t>(length)
         );
         if (result != EMSCRIPTEN_RESULT_SUCCESS) {
-            OC_LOG_WARN("[WebSocket] Send failed: {}", result);
+            counters_.onSendError();
+            sendFailedLog_.hit(result);
+        } else {
+            counters_.onSend(length);
         }
     } else {
         // Buffer for later
         if (config_.maxPendingMessages == 0 || 
             pendingMessages_.size() < config_.maxPendingMessages) {
-            pendingMessages_.emplace_back(data, data + length);
+            pendingMessages_.emplace_back(data, length, framePool_);
         } else {
             // Drop oldest message to make room
-            pendingMessages_.erase(pendingMessages_.begin());
-            pendingMessages_.emplace_back(data, data + length);
-            OC_LOG_WARN("[WebSocket] Buffer full, dropped oldest message");
+            pendingMessages_.pop_front();
+            pendingMessages_.emplace_back(data, length, framePool_);
+            counters_.onDroppedOldest();
+            bufferFullLog_.hit();
         }
+        counters_.setBufferedFrames(pendingMessages_.size());
     }
 }
 
@@ -133,13 +151,19 @@ void WebSocketTransport::flushPendingMessages() {
     OC_LOG_INFO("[WebSocket] Flushing {} pending messages", pendingMessages_.size());
 
     for (const auto& msg : pendingMessages_) {
-        emscripten_websocket_send_binary(
+        EMSCRIPTEN_RESULT result = emscripten_websocket_send_binary(
             socket_, 
             const_cast<void*>(static_cast<const void*>(msg.data())), 
             static_cast<uint32_t>(msg.size())
         );
+        if (result != EMSCRIPTEN_RESULT_SUCCESS) {
+            counters_.onSendError();
+        } else {
+            counters_.onSend(msg.size());
+        }
     }
     pendingMessages_.clear();
+    counters_.setBufferedFrames(0);
 }
 
 void WebSocketTransport::scheduleReconnect() {
@@ -182,6 +206,7 @@ EM_BOOL WebSocketTransport::onMessage(int /*eventType*/,
 
     // Only handle binary messages (not text)
     if (!event->isText && self->onReceive_) {
+        self->counters_.onReceive(static_cast<size_t>(event->numBytes));
         self->onReceive_(event->data, static_cast<size_t>(event->numBytes));
     }
 
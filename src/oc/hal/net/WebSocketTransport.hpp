@@ -49,12 +49,17 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <memory_resource>
 #include <string>
-#include <vector>
 
 #include <oc/type/Result.hpp>
 #include <oc/interface/ITransport.hpp>
 
+#include "Frame.hpp"
+#include "RateLimitedLog.hpp"
+#include "TransportStats.hpp"
+
 namespace oc::hal::net {
 
 /**
@@ -75,6 +80,14 @@ struct WebSocketConfig {
 
     /// Maximum pending messages to buffer (0 = unlimited)
     size_t maxPendingMessages = 100;
+
+    /// Allocator for the pending message queue and large buffered frames
+    /// (nullptr = std::pmr::get_default_resource()). Must outlive the transport.
+    std::pmr::memory_resource* memoryResource = nullptr;
+
+    /// Minimum interval between repeated send-failure / buffer-full warnings
+    /// (ms); occurrences in between are counted and reported in the next line
+    uint32_t logIntervalMs = 1000;
 };
 
 /**
@@ -116,7 +129,7 @@ public:
     oc::type::Result<void> init() override;
 
     /**
-     * @brief Handle reconnection timing
+     * @brief Handle reconnection timing and emit deferred warnings
      *
      * Must be called regularly in the main loop.
      * Note: Message receiving is handled by browser callbacks, not here.
@@ -148,6 +161,17 @@ public:
      */
     bool isReady() const override;
 
+    /**
+     * @brief Snapshot of frame/byte/error counters
+     *
+     * bufferedFrames is the current pendingMessages_ depth, reconnects
+     * counts reconnection attempts made by update().
+     */
+    TransportStats stats() const { return counters_.snapshot(); }
+
+    /// Reset cumulative counters to zero
+    void resetStats() { counters_.reset(); }
+
 private:
     /// Connection states
     enum class State {
@@ -172,13 +196,21 @@ private:
 
     ReceiveCallback onReceive_;
 
-    // Message buffering during disconnection
-    std::vector<std::vector<uint8_t>> pendingMessages_;
+    // Message buffering during disconnection (small frames stored inline,
+    // larger ones in framePool_; both backed by config.memoryResource)
+    FramePool framePool_;
+    std::pmr::deque<Frame> pendingMessages_;
 
     // Reconnection timing (uses oc::time::millis())
     uint32_t lastAttemptMs_ = 0;
     uint32_t currentDelayMs_ = 0;
     uint32_t reconnectAttempts_ = 0;
+
+    TransportCounters counters_;
+
+    // Hot-path warnings: counted in send(), formatted in update()
+    RateLimitedLogSite sendFailedLog_;
+    RateLimitedLogSite bufferFullLog_;
 };
 
 }  // namespace oc::hal::net
@@ -0,0 +1,62 @@
+/**
+ * @file ImpairedTransportTest.cpp
+ * @brief ImpairedTransport bandwidth limit on a virtual clock
+ */
+
+#include <cstdint>
+
+#include <oc/hal/net/ImpairedTransport.hpp>
+#include <oc/hal/net/LoopbackTransport.hpp>
+
+#include "TestCheck.hpp"
+
+using namespace oc::hal::net;
+
+namespace {
+
+/// Frames of frameSize sent at t = 0, delivered by elapsedUs at the given rate
+size_t deliveredAfter(uint64_t rateBytesPerSec, size_t frameSize, size_t frames,
+                      uint64_t elapsedUs) {
+    LoopbackConfig loopback;
+    loopback.capacity = 4096;
+    LoopbackTransportPair pair(loopback);
+    pair.a().init();
+    pair.b().init();
+
+    uint64_t simTimeUs = 0;
+    ImpairmentConfig config;
+    config.tx.rateLimitBytesPerSec = rateBytesPerSec;
+    config.clock = [&] { return simTimeUs; };
+    ImpairedTransport impaired(pair.a(), config);
+
+    size_t received = 0;
+    pair.b().setOnReceive([&](const uint8_t*, size_t) { received++; });
+
+    uint8_t frame[256] = {};
+    for (size_t i = 0; i < frames; ++i) {
+        impaired.send(frame, frameSize);
+    }
+    simTimeUs = elapsedUs;
+    impaired.update();
+    pair.b().update();
+    return received;
+}
+
+void testSmallFramesAtHighRate() {
+    // 64 B at 125 MB/s = 512 ns each: 500 fit in 256 µs (not all 1000)
+    OC_CHECK_EQ(deliveredAfter(125000000, 64, 1000, 256), 500u);
+    OC_CHECK_EQ(deliveredAfter(125000000, 64, 1000, 512), 1000u);
+}
+
+void testNoDriftAtLowRate() {
+    // 64 B at 10 MB/s = 6.4 µs each: 156 by 1000 µs (truncating to 6 µs gave 166)
+    OC_CHECK_EQ(deliveredAfter(10000000, 64, 1000, 1000), 156u);
+}
+
+}  // namespace
+
+int main() {
+    testSmallFramesAtHighRate();
+    testNoDriftAtLowRate();
+    return test::result();
+}
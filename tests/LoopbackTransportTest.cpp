@@ -0,0 +1,72 @@
+/**
+ * @file LoopbackTransportTest.cpp
+ * @brief LoopbackTransportPair delivery order, batching and counters
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <oc/hal/net/LoopbackTransport.hpp>
+
+#include "TestCheck.hpp"
+
+using namespace oc::hal::net;
+
+namespace {
+
+void testRoundTrip() {
+    LoopbackTransportPair pair;
+    OC_CHECK(pair.a().init().isOk());
+    OC_CHECK(pair.b().init().isOk());
+
+    std::vector<uint8_t> received;
+    pair.b().setOnReceive([&](const uint8_t* data, size_t length) {
+        OC_CHECK_EQ(length, 1u);
+        received.push_back(data[0]);
+    });
+
+    for (uint8_t i = 0; i < 3; ++i) {
+        pair.a().send(&i, 1);
+    }
+    pair.b().update();
+
+    OC_CHECK_EQ(received.size(), 3u);
+    for (size_t i = 0; i < received.size(); ++i) {
+        OC_CHECK_EQ(received[i], i);
+    }
+
+    TransportStats tx = pair.a().stats();
+    TransportStats rx = pair.b().stats();
+    OC_CHECK_EQ(tx.txFrames, 3u);
+    OC_CHECK_EQ(rx.rxFrames, 3u);
+    OC_CHECK_EQ(rx.rxBytes, 3u);
+}
+
+void testMaxFramesPerUpdate() {
+    LoopbackConfig config;
+    config.maxFramesPerUpdate = 2;
+    LoopbackTransportPair pair(config);
+    pair.a().init();
+    pair.b().init();
+
+    size_t frames = 0;
+    pair.b().setOnReceive([&](const uint8_t*, size_t) { frames++; });
+
+    uint8_t byte = 0;
+    for (int i = 0; i < 5; ++i) {
+        pair.a().send(&byte, 1);
+    }
+    pair.b().update();
+    OC_CHECK_EQ(frames, 2u);
+    pair.b().update();
+    pair.b().update();
+    OC_CHECK_EQ(frames, 5u);
+}
+
+}  // namespace
+
+int main() {
+    testRoundTrip();
+    testMaxFramesPerUpdate();
+    return test::result();
+}
@@ -0,0 +1,82 @@
+/**
+ * @file MuxTransportTest.cpp
+ * @brief MuxTransport scheduling and configuration edge cases
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <oc/hal/net/LoopbackTransport.hpp>
+#include <oc/hal/net/MuxTransport.hpp>
+
+#include "TestCheck.hpp"
+
+using namespace oc::hal::net;
+
+namespace {
+
+/// quantumBytes = 0 used to spin forever in the first update()
+void testZeroQuantum() {
+    LoopbackTransportPair pair;
+    MuxConfig config;
+    config.channels.resize(2);
+    config.quantumBytes = 0;
+    MuxTransport tx(pair.a(), config);
+    MuxTransport rx(pair.b(), config);
+
+    std::vector<uint8_t> received;
+    rx.setOnChannelReceive([&](uint8_t channel, const uint8_t* data, size_t length) {
+        OC_CHECK_EQ(length, 100u);
+        received.push_back(channel);
+        (void)data;
+    });
+
+    std::vector<uint8_t> payload(100, 0xAB);
+    for (int i = 0; i < 3; ++i) {
+        OC_CHECK(tx.send(0, payload.data(), payload.size()));
+        OC_CHECK(tx.send(1, payload.data(), payload.size()));
+    }
+    tx.update();
+    rx.update();
+
+    OC_CHECK_EQ(tx.queuedFrames(), 0u);
+    OC_CHECK_EQ(received.size(), 6u);
+}
+
+void testStrictPriority() {
+    LoopbackTransportPair pair;
+    MuxConfig config;
+    config.channels.resize(2);
+    config.channels[0].priority = 1;  // Bulk
+    config.channels[1].priority = 0;  // Control
+    MuxTransport tx(pair.a(), config);
+    MuxTransport rx(pair.b(), config);
+
+    std::vector<uint8_t> received;
+    rx.setOnChannelReceive([&](uint8_t channel, const uint8_t*, size_t) {
+        received.push_back(channel);
+    });
+
+    uint8_t byte = 0;
+    OC_CHECK(tx.send(0, &byte, 1));
+    OC_CHECK(tx.send(0, &byte, 1));
+    OC_CHECK(tx.send(1, &byte, 1));
+    OC_CHECK(!tx.send(2, &byte, 1));
+    tx.update();
+    rx.update();
+
+    OC_CHECK_EQ(received.size(), 3u);
+    if (received.size() == 3) {
+        OC_CHECK_EQ(received[0], 1u);
+        OC_CHECK_EQ(received[1], 0u);
+        OC_CHECK_EQ(received[2], 0u);
+    }
+}
+
+}  // namespace
+
+int main() {
+    testZeroQuantum();
+    testStrictPriority();
+    return test::result();
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+/**
+ * @file TestCheck.hpp
+ * @brief Minimal assertion helpers for the oc-hal-net tests
+ *
+ * Each test is a plain executable registered with CTest; no test framework
+ * dependency. OC_CHECK records a failure and keeps going, so one run
+ * reports every broken expectation.
+ *
+ * ```cpp
+ * int main() {
+ *     OC_CHECK(transport.isReady());
+ *     OC_CHECK_EQ(frames, 3u);
+ *     return oc::hal::net::test::result();
+ * }
+ * ```
+ */
+
+#include <cstdio>
+
+namespace oc::hal::net::test {
+
+inline int& failures() {
+    static int count = 0;
+    return count;
+}
+
+/// Exit code for main(): 0 if every check passed
+inline int result() {
+    if (failures() > 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", failures());
+        return 1;
+    }
+    return 0;
+}
+
+}  // namespace oc::hal::net::test
+
+#define OC_CHECK(cond)                                                              \
+    do {                                                                            \
+        if (!(cond)) {                                                              \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++::oc::hal::net::test::failures();                                     \
+        }                                                                           \
+    } while (0)
+
+#define OC_CHECK_EQ(actual, expected)                                               \
+    do {                                                                            \
+        auto&& ocActual = (actual);                                                 \
+        auto&& ocExpected = (expected);                                             \
+        if (!(ocActual == ocExpected)) {                                            \
+            std::fprintf(stderr, "%s:%d: check failed: %s == %s (%llu vs %llu)\n",  \
+                         __FILE__, __LINE__, #actual, #expected,                    \
+                         static_cast<unsigned long long>(ocActual),                 \
+                         static_cast<unsigned long long>(ocExpected));              \
+            ++::oc::hal::net::test::failures();                                     \
+        }                                                                           \
+    } while (0)
@@ -0,0 +1,80 @@
+/**
+ * @file UdpMulticastTest.cpp
+ * @brief One UdpTransport send() fans out to every group member on lo
+ *
+ * Returns 77 (skipped) if the host cannot join a multicast group on the
+ * loopback interface (e.g. a sandbox without multicast routing).
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include <oc/hal/net/UdpTransport.hpp>
+
+#include "TestCheck.hpp"
+
+using namespace oc::hal::net;
+
+namespace {
+
+constexpr int kSkipped = 77;
+constexpr const char* kGroup = "239.255.0.77";
+constexpr uint16_t kGroupPort = 47177;
+constexpr int kFrames = 20;
+
+UdpConfig groupConfig() {
+    UdpConfig config;
+    config.host = kGroup;
+    config.port = kGroupPort;
+    config.multicastInterface = "lo";
+    config.multicastLoopback = true;
+    return config;
+}
+
+}  // namespace
+
+int main() {
+    UdpConfig receiverConfig = groupConfig();
+    receiverConfig.localPort = kGroupPort;
+    receiverConfig.multicastJoin = true;
+    receiverConfig.maxFramesPerUpdate = kFrames;
+
+    UdpTransport first(receiverConfig);
+    UdpTransport second(receiverConfig);
+    UdpTransport sender(groupConfig());
+    if (!first.init().isOk() || !second.init().isOk() || !sender.init().isOk()) {
+        return kSkipped;
+    }
+
+    int firstFrames = 0;
+    int secondFrames = 0;
+    first.setOnReceive([&](const uint8_t* data, size_t length) {
+        OC_CHECK_EQ(length, 2u);
+        OC_CHECK_EQ(data[0], firstFrames);
+        firstFrames++;
+    });
+    second.setOnReceive([&](const uint8_t* data, size_t length) {
+        OC_CHECK_EQ(length, 2u);
+        OC_CHECK_EQ(data[0], secondFrames);
+        secondFrames++;
+    });
+
+    for (int i = 0; i < kFrames; ++i) {
+        uint8_t frame[2] = {static_cast<uint8_t>(i), 0xAB};
+        sender.send(frame, sizeof(frame));
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while ((firstFrames < kFrames || secondFrames < kFrames) &&
+           std::chrono::steady_clock::now() < deadline) {
+        first.update();
+        second.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    OC_CHECK_EQ(firstFrames, kFrames);
+    OC_CHECK_EQ(secondFrames, kFrames);
+    OC_CHECK_EQ(sender.stats().txFrames, static_cast<uint64_t>(kFrames));
+    return test::result();
+}